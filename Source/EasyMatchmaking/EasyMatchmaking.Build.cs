@@ -48,7 +48,8 @@ public class EasyMatchmaking : ModuleRules
 				"Slate",
 				"SlateCore",
                 "EOSSDK",       
-				"Projects"          
+				"Projects",
+                "Icmp"          // for region pings
 				// ... add private dependencies that you statically link with here ...	
 			}
 			);
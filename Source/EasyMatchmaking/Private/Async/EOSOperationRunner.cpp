@@ -0,0 +1,261 @@
+#include "Async/EOSOperationRunner.h"
+
+#include <eos_common.h>
+
+#include "Containers/Ticker.h"
+
+#include "Async/EOSOperationTracker.h"
+#include "EasyMatchmakingLog.h"
+#include "EasyMatchmakingSettings.h"
+
+namespace
+{
+    const TCHAR* GetServiceName(EEOSService Service)
+    {
+        switch (Service)
+        {
+        case EEOSService::Lobby: return TEXT("Lobby");
+        case EEOSService::Sessions: return TEXT("Sessions");
+        case EEOSService::Auth: return TEXT("Auth");
+        case EEOSService::Connect: return TEXT("Connect");
+        case EEOSService::UserInfo: return TEXT("UserInfo");
+        default: return TEXT("Unknown");
+        }
+    }
+
+    FEOSRetryPolicy GetPolicy(const TCHAR* Operation)
+    {
+        const UEasyMatchmakingSettings* Settings = UEasyMatchmakingSettings::Get();
+        return Settings ? Settings->GetRetryPolicy(Operation) : FEOSRetryPolicy();
+    }
+
+    float GetRetryDelay(const FEOSRetryPolicy& Policy, int32 FailedAttempts)
+    {
+        const float Backoff = Policy.InitialDelay * FMath::Pow(FMath::Max(1.0f, Policy.BackoffMultiplier), FailedAttempts - 1);
+        const float Delay = FMath::Min(Backoff, Policy.MaxDelay);
+        return Delay * (1.0f - FMath::Clamp(Policy.Jitter, 0.0f, 1.0f) * FMath::FRand());
+    }
+}
+
+bool FEOSCircuitBreaker::IsOpen(EEOSService Service) const
+{
+    return Get(Service).OpenUntil > FPlatformTime::Seconds();
+}
+
+void FEOSCircuitBreaker::Reset()
+{
+    for (FState& State : States)
+    {
+        State = FState();
+    }
+}
+
+FEOSOperation::FEOSOperation(const FEOSOperationDesc& InDesc, const TSharedRef<FEOSCircuitBreaker>& InCircuitBreaker, void* InClientData, const UObject* InOwner)
+    : Desc(InDesc)
+    , ClientData(InClientData)
+    , CircuitBreaker(InCircuitBreaker)
+    , Owner(InOwner)
+    , bHasOwner(InOwner != nullptr)
+{
+}
+
+FEOSOperation::~FEOSOperation()
+{
+    if (bIsProbe)
+    {
+        CircuitBreaker->Get(Desc.Service).bProbeInFlight = false;
+    }
+
+    if (TrackingId != 0)
+    {
+        FEOSOperationTracker::Get().Cancel(TrackingId);
+    }
+}
+
+bool FEOSOperation::IsTransient(EOS_EResult Result)
+{
+    switch (Result)
+    {
+    case EOS_EResult::EOS_TimedOut:
+    case EOS_EResult::EOS_TooManyRequests:
+    case EOS_EResult::EOS_ServiceFailure:
+    case EOS_EResult::EOS_NoConnection:
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool FEOSOperation::IsNotProcessed(EOS_EResult Result)
+{
+    return Result == EOS_EResult::EOS_TooManyRequests || Result == EOS_EResult::EOS_NoConnection;
+}
+
+void FEOSOperation::Start()
+{
+    Send();
+}
+
+void FEOSOperation::Send()
+{
+    Attempt++;
+
+    FEOSCircuitBreaker::FState& Circuit = CircuitBreaker->Get(Desc.Service);
+    if (Circuit.OpenUntil > 0.0)
+    {
+        // Open, or half open with the one probe already out
+        if (Circuit.OpenUntil > FPlatformTime::Seconds() || Circuit.bProbeInFlight)
+        {
+            EM_LOG_WARNING(TEXT("%s failed fast, %s service is degraded"), Desc.Name, GetServiceName(Desc.Service));
+            FailWithoutSending(EOS_EResult::EOS_ServiceFailure);
+            return;
+        }
+
+        EM_LOG_INFO(TEXT("Probing %s service with %s"), GetServiceName(Desc.Service), Desc.Name);
+        Circuit.bProbeInFlight = true;
+        bIsProbe = true;
+    }
+
+    // Tracked before the call goes out, in case the answer comes before it returns
+    const float Timeout = Desc.bWaitsForUser ? 0.0f : GetPolicy(Desc.Name).Timeout;
+    SentTime = FPlatformTime::Seconds();
+    TrackingId = FEOSOperationTracker::Get().Begin(Desc.Name, Timeout, [this]() { HandleDeadline(); }, Desc.bDeadlineOnlyReports);
+
+    if (!Issue())
+    {
+        FEOSOperationTracker::Get().Cancel(TrackingId);
+        TrackingId = 0;
+        FailWithoutSending(Attempt == 1 ? EOS_EResult::EOS_InvalidState : LastResult);
+    }
+}
+
+void FEOSOperation::HandleDeadline()
+{
+    if (Desc.bDeadlineOnlyReports)
+    {
+        // The tracker already fired OnTimedOut. Failing the caller now would orphan a lobby/session that EOS may still give us.
+        // TrackingId stays, the late answer still goes into the latency stats.
+        EM_LOG_WARNING(TEXT("%s is past its deadline, still waiting for the answer"), Desc.Name);
+        UpdateCircuit(EOS_EResult::EOS_TimedOut);
+        return;
+    }
+
+    TrackingId = 0;
+    bTimedOut = true;
+    LastResult = EOS_EResult::EOS_TimedOut;
+    UpdateCircuit(EOS_EResult::EOS_TimedOut);
+
+    // The operation stays alive for the late answer, EOS still holds it as ClientData
+    if (!bHasOwner || Owner.IsValid())
+    {
+        DeliverWithoutAnswer(EOS_EResult::EOS_TimedOut);
+    }
+}
+
+FEOSOperation::EResultAction FEOSOperation::HandleResult(EOS_EResult Result)
+{
+    if (bTimedOut)
+    {
+        EM_LOG_WARNING(TEXT("%s answered %.1f seconds after it timed out: %s"),
+            Desc.Name, FPlatformTime::Seconds() - SentTime, UTF8_TO_TCHAR(EOS_EResult_ToString(Result)));
+        return EResultAction::Drop;
+    }
+
+    FEOSOperationTracker::Get().Complete(TrackingId, Result == EOS_EResult::EOS_Success);
+    TrackingId = 0;
+    LastResult = Result;
+    UpdateCircuit(Result);
+
+    const bool bTransient = IsTransient(Result);
+    if (!bTransient || !Desc.bCanResend || CircuitBreaker->IsOpen(Desc.Service))
+    {
+        return EResultAction::Deliver;
+    }
+
+    if (!Desc.bIdempotent && !IsNotProcessed(Result))
+    {
+        return EResultAction::Deliver;
+    }
+
+    const FEOSRetryPolicy Policy = GetPolicy(Desc.Name);
+    if (Attempt >= Policy.MaxAttempts)
+    {
+        EM_LOG_WARNING(TEXT("%s failed after %d attempts: %s"), Desc.Name, Attempt, UTF8_TO_TCHAR(EOS_EResult_ToString(Result)));
+        return EResultAction::Deliver;
+    }
+
+    const float Delay = GetRetryDelay(Policy, Attempt);
+    EM_LOG_WARNING(TEXT("%s failed (%s), retrying in %.2f seconds (attempt %d of %d)"),
+        Desc.Name, UTF8_TO_TCHAR(EOS_EResult_ToString(Result)), Delay, Attempt + 1, Policy.MaxAttempts);
+    ScheduleRetry(Delay);
+    return EResultAction::Retry;
+}
+
+void FEOSOperation::UpdateCircuit(EOS_EResult Result)
+{
+    const UEasyMatchmakingSettings* Settings = UEasyMatchmakingSettings::Get();
+    const int32 Threshold = Settings ? Settings->CircuitBreakerFailureThreshold : 0;
+    const float Cooldown = Settings ? Settings->CircuitBreakerCooldown : 0.0f;
+
+    FEOSCircuitBreaker::FState& Circuit = CircuitBreaker->Get(Desc.Service);
+    if (bIsProbe)
+    {
+        Circuit.bProbeInFlight = false;
+        bIsProbe = false;
+    }
+
+    const bool bTransient = IsTransient(Result);
+    if (bTransient)
+    {
+        Circuit.ConsecutiveFailures++;
+        const bool bWasHalfOpen = Circuit.OpenUntil > 0.0;
+        if (Threshold > 0 && (bWasHalfOpen || Circuit.ConsecutiveFailures >= Threshold))
+        {
+            if (!CircuitBreaker->IsOpen(Desc.Service))
+            {
+                EM_LOG_WARNING(TEXT("%s service is degraded after %d failures (%s), failing calls for %.0f seconds"),
+                    GetServiceName(Desc.Service), Circuit.ConsecutiveFailures, UTF8_TO_TCHAR(EOS_EResult_ToString(Result)), Cooldown);
+            }
+            Circuit.OpenUntil = FPlatformTime::Seconds() + Cooldown;
+        }
+    }
+    else if (Circuit.ConsecutiveFailures > 0 || Circuit.OpenUntil > 0.0)
+    {
+        if (Circuit.OpenUntil > 0.0)
+        {
+            EM_LOG_INFO(TEXT("%s service is back"), GetServiceName(Desc.Service));
+        }
+        Circuit = FEOSCircuitBreaker::FState();
+    }
+}
+
+void FEOSOperation::ScheduleRetry(float Delay)
+{
+    FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([this](float)
+    {
+        if (bHasOwner && !Owner.IsValid())
+        {
+            // Nobody is left to take the answer
+            EM_LOG_INFO(TEXT("Dropped retry of %s, its owner is gone"), Desc.Name);
+            delete this;
+            return false;
+        }
+
+        Send();
+        return false;
+    }), Delay);
+}
+
+void FEOSOperation::FailWithoutSending(EOS_EResult Result)
+{
+    // Next tick, callers don't expect their callback to run before the call returns
+    FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([this, Result](float)
+    {
+        if (!bHasOwner || Owner.IsValid())
+        {
+            DeliverWithoutAnswer(Result);
+        }
+        delete this;
+        return false;
+    }));
+}
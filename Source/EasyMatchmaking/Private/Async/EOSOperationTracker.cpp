@@ -0,0 +1,288 @@
+#include "Async/EOSOperationTracker.h"
+
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#include "EasyMatchmakingLog.h"
+
+namespace
+{
+    constexpr double BucketGrowth = 1.25;
+    constexpr float DeadlineCheckInterval = 0.1f;
+}
+
+void FLatencyHistogram::Add(double Ms)
+{
+    Ms = FMath::Max(0.0, Ms);
+    Buckets[GetBucket(Ms)]++;
+    Count++;
+    Sum += Ms;
+    Max = FMath::Max(Max, Ms);
+}
+
+void FLatencyHistogram::Reset()
+{
+    *this = FLatencyHistogram();
+}
+
+double FLatencyHistogram::GetPercentile(double Percentile) const
+{
+    if (Count == 0)
+    {
+        return 0.0;
+    }
+
+    const int32 Target = FMath::Max(1, FMath::CeilToInt(Count * FMath::Clamp(Percentile, 0.0, 100.0) / 100.0));
+    int32 Seen = 0;
+    for (int32 Bucket = 0; Bucket < NumBuckets; Bucket++)
+    {
+        Seen += Buckets[Bucket];
+        if (Seen >= Target)
+        {
+            return FMath::Min(GetBucketUpperBound(Bucket), Max);
+        }
+    }
+    return Max;
+}
+
+int32 FLatencyHistogram::GetBucket(double Ms)
+{
+    if (Ms <= 1.0)
+    {
+        return 0;
+    }
+    return FMath::Min(NumBuckets - 1, FMath::CeilToInt(FMath::Loge(Ms) / FMath::Loge(BucketGrowth)));
+}
+
+double FLatencyHistogram::GetBucketUpperBound(int32 Bucket)
+{
+    return FMath::Pow(BucketGrowth, static_cast<double>(Bucket));
+}
+
+FEOSOperationTracker& FEOSOperationTracker::Get()
+{
+    static FEOSOperationTracker Tracker;
+    return Tracker;
+}
+
+uint64 FEOSOperationTracker::Begin(const TCHAR* Operation, float Timeout, TFunction<void()>&& OnDeadline, bool bStaysAfterDeadline)
+{
+    const uint64 OperationId = NextOperationId++;
+
+    FInFlightOperation& Entry = InFlight.Add(OperationId);
+    Entry.Operation = Operation;
+    Entry.StartTime = FPlatformTime::Seconds();
+    Entry.Deadline = Timeout > 0.0f ? Entry.StartTime + Timeout : 0.0;
+    Entry.OnDeadline = MoveTemp(OnDeadline);
+    Entry.bStaysAfterDeadline = bStaysAfterDeadline;
+
+    if (Entry.Deadline > 0.0 && !TickerHandle.IsValid())
+    {
+        TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateRaw(this, &FEOSOperationTracker::CheckDeadlines), DeadlineCheckInterval);
+    }
+
+    return OperationId;
+}
+
+bool FEOSOperationTracker::Complete(uint64 OperationId, bool bSucceeded)
+{
+    FInFlightOperation Entry;
+    if (!InFlight.RemoveAndCopyValue(OperationId, Entry))
+    {
+        return false;
+    }
+
+    FOperationRecord& Record = Records.FindOrAdd(Entry.Operation);
+    Record.Latency.Add((FPlatformTime::Seconds() - Entry.StartTime) * 1000.0);
+    if (!bSucceeded)
+    {
+        Record.Failures++;
+    }
+    return true;
+}
+
+void FEOSOperationTracker::Cancel(uint64 OperationId)
+{
+    InFlight.Remove(OperationId);
+}
+
+bool FEOSOperationTracker::CheckDeadlines(float DeltaTime)
+{
+    const double Now = FPlatformTime::Seconds();
+
+    TArray<uint64> Expired;
+    bool bAnyDeadline = false;
+    for (const TPair<uint64, FInFlightOperation>& Pair : InFlight)
+    {
+        if (Pair.Value.Deadline <= 0.0)
+        {
+            continue;
+        }
+
+        if (Pair.Value.Deadline <= Now)
+        {
+            Expired.Add(Pair.Key);
+        }
+        else
+        {
+            bAnyDeadline = true;
+        }
+    }
+
+    // Handlers may start new calls, so the map is not touched while they run
+    for (uint64 OperationId : Expired)
+    {
+        FInFlightOperation Entry;
+        FInFlightOperation* Staying = InFlight.Find(OperationId);
+        if (Staying && Staying->bStaysAfterDeadline)
+        {
+            // Fires once, the answer still completes it
+            Staying->Deadline = 0.0;
+            Entry.Operation = Staying->Operation;
+            Entry.StartTime = Staying->StartTime;
+            Entry.OnDeadline = MoveTemp(Staying->OnDeadline);
+        }
+        else
+        {
+            InFlight.RemoveAndCopyValue(OperationId, Entry);
+        }
+
+        const double Seconds = Now - Entry.StartTime;
+        Records.FindOrAdd(Entry.Operation).TimedOut++;
+        EM_LOG_ERROR(TEXT("%s (%llu) got no answer in %.1f seconds"), *Entry.Operation, OperationId, Seconds);
+
+        OnTimedOut.Broadcast(Entry.Operation, OperationId, Seconds);
+        if (Entry.OnDeadline)
+        {
+            Entry.OnDeadline();
+        }
+    }
+
+    if (!bAnyDeadline)
+    {
+        // Calls started by the handlers above armed a new ticker if they need one
+        for (const TPair<uint64, FInFlightOperation>& Pair : InFlight)
+        {
+            if (Pair.Value.Deadline > 0.0)
+            {
+                return true;
+            }
+        }
+
+        TickerHandle.Reset();
+        return false;
+    }
+    return true;
+}
+
+FEOSOperationStats FEOSOperationTracker::MakeStats(const FString& Operation, const FOperationRecord& Record) const
+{
+    FEOSOperationStats Stats;
+    Stats.Operation = Operation;
+    Stats.Count = Record.Latency.Num();
+    Stats.Failures = Record.Failures;
+    Stats.TimedOut = Record.TimedOut;
+    Stats.AverageMs = Record.Latency.GetAverage();
+    Stats.P50Ms = Record.Latency.GetPercentile(50.0);
+    Stats.P95Ms = Record.Latency.GetPercentile(95.0);
+    Stats.P99Ms = Record.Latency.GetPercentile(99.0);
+    Stats.MaxMs = Record.Latency.GetMax();
+
+    for (const TPair<uint64, FInFlightOperation>& Pair : InFlight)
+    {
+        if (Pair.Value.Operation == Operation)
+        {
+            Stats.InFlight++;
+        }
+    }
+    return Stats;
+}
+
+TArray<FEOSOperationStats> FEOSOperationTracker::GetStats() const
+{
+    TMap<FString, FOperationRecord> AllOperations = Records;
+    for (const TPair<uint64, FInFlightOperation>& Pair : InFlight)
+    {
+        // Operations that never got an answer yet still show up
+        AllOperations.FindOrAdd(Pair.Value.Operation);
+    }
+
+    TArray<FEOSOperationStats> Stats;
+    Stats.Reserve(AllOperations.Num());
+    for (const TPair<FString, FOperationRecord>& Pair : AllOperations)
+    {
+        Stats.Add(MakeStats(Pair.Key, Pair.Value));
+    }
+
+    Stats.Sort([](const FEOSOperationStats& A, const FEOSOperationStats& B) { return A.Operation < B.Operation; });
+    return Stats;
+}
+
+bool FEOSOperationTracker::FindStats(const FString& Operation, FEOSOperationStats& OutStats) const
+{
+    const FOperationRecord* Record = Records.Find(Operation);
+    if (!Record)
+    {
+        return false;
+    }
+
+    OutStats = MakeStats(Operation, *Record);
+    return true;
+}
+
+bool FEOSOperationTracker::DumpToFile(const FString& FilePath) const
+{
+    const FString Path = FilePath.IsEmpty()
+        ? FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("EasyMatchmaking"), TEXT("OperationStats.csv"))
+        : FilePath;
+
+    FString Csv = TEXT("Operation,Count,Failures,TimedOut,InFlight,AverageMs,P50Ms,P95Ms,P99Ms,MaxMs\n");
+    for (const FEOSOperationStats& Stats : GetStats())
+    {
+        Csv += FString::Printf(TEXT("%s,%d,%d,%d,%d,%.1f,%.1f,%.1f,%.1f,%.1f\n"),
+            *Stats.Operation, Stats.Count, Stats.Failures, Stats.TimedOut, Stats.InFlight,
+            Stats.AverageMs, Stats.P50Ms, Stats.P95Ms, Stats.P99Ms, Stats.MaxMs);
+    }
+
+    if (!FFileHelper::SaveStringToFile(Csv, *Path))
+    {
+        EM_LOG_ERROR(TEXT("Failed to write operation stats to %s"), *Path);
+        return false;
+    }
+
+    EM_LOG_INFO(TEXT("Wrote operation stats to %s"), *Path);
+    return true;
+}
+
+void FEOSOperationTracker::LogStats() const
+{
+    for (const FEOSOperationStats& Stats : GetStats())
+    {
+        EM_LOG_INFO(TEXT("%-20s %5d calls, %d failed, %d timed out, %d in flight | p50 %.1f ms, p95 %.1f ms, p99 %.1f ms, max %.1f ms"),
+            *Stats.Operation, Stats.Count, Stats.Failures, Stats.TimedOut, Stats.InFlight,
+            Stats.P50Ms, Stats.P95Ms, Stats.P99Ms, Stats.MaxMs);
+    }
+}
+
+void FEOSOperationTracker::Reset()
+{
+    // In flight calls keep their deadlines, only the history goes
+    Records.Reset();
+}
+
+namespace
+{
+    void DumpOperationStats(const TArray<FString>& Args)
+    {
+        FEOSOperationTracker& Tracker = FEOSOperationTracker::Get();
+        Tracker.LogStats();
+        Tracker.DumpToFile(Args.Num() > 0 ? Args[0] : FString());
+    }
+
+    FAutoConsoleCommand DumpOperationStatsCommand(
+        TEXT("EasyMatchmaking.DumpOperationStats"),
+        TEXT("Logs p50/p95/p99 latency per EOS operation and writes them as CSV to the given path (default Saved/EasyMatchmaking/OperationStats.csv)"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&DumpOperationStats));
+}
@@ -0,0 +1,448 @@
+#include "Async/MatchmakingAsyncActions.h"
+
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+
+#include "EOSManager.h"
+#include "EasyMatchmakingLog.h"
+
+void UMatchmakingAsyncAction::Setup(UObject* WorldContextObject)
+{
+    UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull) : nullptr;
+    UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+    if (GameInstance)
+    {
+        EOSManager = GameInstance->GetSubsystem<UEOSManager>();
+        RegisterWithGameInstance(GameInstance);
+    }
+}
+
+void UMatchmakingAsyncAction::Activate()
+{
+    if (!EOSManager.IsValid())
+    {
+        EM_LOG_ERROR(TEXT("%s has no EOS manager, is the world context valid?"), *GetClass()->GetName());
+        Finish(EOS_EResult::EOS_InvalidState);
+        return;
+    }
+
+    Start();
+}
+
+TFuture<FMatchmakingResult> UMatchmakingAsyncAction::ActivateAsFuture()
+{
+    Promise = MakeShared<TPromise<FMatchmakingResult>>();
+    TFuture<FMatchmakingResult> Future = Promise->GetFuture();
+    Activate();
+    return Future;
+}
+
+void UMatchmakingAsyncAction::Finish(EOS_EResult Result, const FString& Id)
+{
+    if (bFinished)
+    {
+        return;
+    }
+    bFinished = true;
+
+    Cleanup();
+
+    FMatchmakingResult Outcome;
+    Outcome.Result = Result;
+    Outcome.Id = Id;
+
+    if (Outcome.IsSuccess())
+    {
+        OnSuccess.Broadcast(Id, FString());
+    }
+    else
+    {
+        OnFailure.Broadcast(Id, Outcome.GetError());
+    }
+
+    if (Promise.IsValid())
+    {
+        TSharedPtr<TPromise<FMatchmakingResult>> FinishedPromise = MoveTemp(Promise);
+        FinishedPromise->SetValue(MoveTemp(Outcome));
+    }
+
+    SetReadyToDestroy();
+}
+
+UEOSLobbyManager* UMatchmakingAsyncAction::GetLobbyManager() const
+{
+    return EOSManager.IsValid() ? EOSManager->GetLobbyManager() : nullptr;
+}
+
+UEOSSessionManager* UMatchmakingAsyncAction::GetSessionManager() const
+{
+    return EOSManager.IsValid() ? EOSManager->GetSessionManager() : nullptr;
+}
+
+// ---------------------------------------------------------------
+// Lobby
+// ---------------------------------------------------------------
+
+void ULobbyOperationAsyncAction::Start()
+{
+    UEOSLobbyManager* LobbyManager = GetLobbyManager();
+    if (!LobbyManager)
+    {
+        Finish(EOS_EResult::EOS_InvalidState);
+        return;
+    }
+
+    // Bound before the call, a call that can't start reports it right away
+    OperationHandle = LobbyManager->OnLobbyOperationComplete.AddUObject(this, &ULobbyOperationAsyncAction::HandleOperationComplete);
+    bCalling = true;
+    RequestId = Call(LobbyManager);
+    bCalling = false;
+
+    if (const FMatchmakingResult* Early = ResultsDuringCall.Find(RequestId))
+    {
+        Finish(Early->Result, Early->Id);
+    }
+    ResultsDuringCall.Reset();
+}
+
+void ULobbyOperationAsyncAction::Cleanup()
+{
+    if (UEOSLobbyManager* LobbyManager = GetLobbyManager())
+    {
+        LobbyManager->OnLobbyOperationComplete.Remove(OperationHandle);
+    }
+    OperationHandle.Reset();
+}
+
+void ULobbyOperationAsyncAction::HandleOperationComplete(ELobbyOperation Operation, EOS_EResult Result, const FString& LobbyId, int32 InRequestId)
+{
+    if (Operation != GetOperation())
+    {
+        return;
+    }
+
+    // Our id is not known until Call returns, keep what came in meanwhile
+    if (bCalling && InRequestId != 0)
+    {
+        ResultsDuringCall.Add(InRequestId, FMatchmakingResult{ Result, LobbyId });
+        return;
+    }
+
+    if (IsOwnResult(InRequestId, LobbyId))
+    {
+        Finish(Result, LobbyId);
+    }
+}
+
+UAsyncCreateLobby* UAsyncCreateLobby::CreateLobbyAsync(UObject* WorldContextObject, const FLobbySettings& Settings)
+{
+    UAsyncCreateLobby* Action = NewObject<UAsyncCreateLobby>();
+    Action->Settings = Settings;
+    Action->Setup(WorldContextObject);
+    return Action;
+}
+
+UAsyncJoinLobby* UAsyncJoinLobby::JoinLobbyAsync(UObject* WorldContextObject, const FString& LobbyId)
+{
+    UAsyncJoinLobby* Action = NewObject<UAsyncJoinLobby>();
+    Action->LobbyId = LobbyId;
+    Action->Setup(WorldContextObject);
+    return Action;
+}
+
+UAsyncLeaveLobby* UAsyncLeaveLobby::LeaveLobbyAsync(UObject* WorldContextObject)
+{
+    UAsyncLeaveLobby* Action = NewObject<UAsyncLeaveLobby>();
+    Action->Setup(WorldContextObject);
+    return Action;
+}
+
+UAsyncDestroyLobby* UAsyncDestroyLobby::DestroyLobbyAsync(UObject* WorldContextObject)
+{
+    UAsyncDestroyLobby* Action = NewObject<UAsyncDestroyLobby>();
+    Action->Setup(WorldContextObject);
+    return Action;
+}
+
+UAsyncSetLobbyAttribute* UAsyncSetLobbyAttribute::SetLobbyAttributeAsync(UObject* WorldContextObject, ELobbyAttributeScope Scope, const FString& Key, const FLobbyAttributeValue& Value)
+{
+    UAsyncSetLobbyAttribute* Action = NewObject<UAsyncSetLobbyAttribute>();
+    Action->Scope = Scope;
+    Action->Key = Key;
+    Action->Value = Value;
+    Action->Setup(WorldContextObject);
+    return Action;
+}
+
+void UAsyncSetLobbyAttribute::Start()
+{
+    UEOSLobbyManager* LobbyManager = GetLobbyManager();
+    if (!LobbyManager)
+    {
+        Finish(EOS_EResult::EOS_InvalidState);
+        return;
+    }
+
+    TWeakObjectPtr<UAsyncSetLobbyAttribute> WeakThis(this);
+    const FString LobbyId = LobbyManager->GetCurrentLobbyId();
+    LobbyManager->SetLobbyAttribute(Scope, Key, Value, [WeakThis, LobbyId](EOS_EResult Result)
+    {
+        if (UAsyncSetLobbyAttribute* Action = WeakThis.Get())
+        {
+            Action->Finish(Result, LobbyId);
+        }
+    });
+}
+
+UAsyncQuickMatch* UAsyncQuickMatch::QuickMatchAsync(UObject* WorldContextObject, const FQuickMatchSettings& Settings)
+{
+    UAsyncQuickMatch* Action = NewObject<UAsyncQuickMatch>();
+    Action->Settings = Settings;
+    Action->Setup(WorldContextObject);
+    return Action;
+}
+
+void UAsyncQuickMatch::Start()
+{
+    UEOSLobbyManager* LobbyManager = GetLobbyManager();
+    if (!LobbyManager)
+    {
+        Finish(EOS_EResult::EOS_InvalidState);
+        return;
+    }
+
+    LobbyManager->OnQuickMatchComplete.AddDynamic(this, &UAsyncQuickMatch::HandleQuickMatchComplete);
+    if (!LobbyManager->QuickMatch(Settings))
+    {
+        Finish(EOS_EResult::EOS_InvalidState);
+    }
+}
+
+void UAsyncQuickMatch::Cleanup()
+{
+    if (UEOSLobbyManager* LobbyManager = GetLobbyManager())
+    {
+        LobbyManager->OnQuickMatchComplete.RemoveDynamic(this, &UAsyncQuickMatch::HandleQuickMatchComplete);
+    }
+}
+
+void UAsyncQuickMatch::HandleQuickMatchComplete(EQuickMatchResult Result, const FString& LobbyId)
+{
+    switch (Result)
+    {
+    case EQuickMatchResult::Joined:
+    case EQuickMatchResult::Created:
+        Finish(EOS_EResult::EOS_Success, LobbyId);
+        break;
+    case EQuickMatchResult::NoLobbyFound:
+        Finish(EOS_EResult::EOS_NotFound);
+        break;
+    case EQuickMatchResult::Cancelled:
+        Finish(EOS_EResult::EOS_Canceled);
+        break;
+    default:
+        Finish(EOS_EResult::EOS_UnexpectedError);
+        break;
+    }
+}
+
+UAsyncWaitForAllPlayersReady* UAsyncWaitForAllPlayersReady::WaitForAllPlayersReady(UObject* WorldContextObject, float TimeoutSeconds)
+{
+    UAsyncWaitForAllPlayersReady* Action = NewObject<UAsyncWaitForAllPlayersReady>();
+    Action->TimeoutSeconds = TimeoutSeconds;
+    Action->Setup(WorldContextObject);
+    return Action;
+}
+
+void UAsyncWaitForAllPlayersReady::Start()
+{
+    UEOSLobbyManager* LobbyManager = GetLobbyManager();
+    if (!LobbyManager || !LobbyManager->IsInLobby())
+    {
+        Finish(EOS_EResult::EOS_NotFound);
+        return;
+    }
+
+    if (LobbyManager->AreAllPlayersReady())
+    {
+        Finish(EOS_EResult::EOS_Success, LobbyManager->GetCurrentLobbyId());
+        return;
+    }
+
+    LobbyManager->OnAllPlayersReady.AddDynamic(this, &UAsyncWaitForAllPlayersReady::HandleAllPlayersReady);
+    LobbyManager->OnLobbyLeft.AddDynamic(this, &UAsyncWaitForAllPlayersReady::HandleLobbyLeft);
+
+    if (TimeoutSeconds > 0.0f)
+    {
+        TWeakObjectPtr<UAsyncWaitForAllPlayersReady> WeakThis(this);
+        TimeoutHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([WeakThis](float)
+        {
+            if (UAsyncWaitForAllPlayersReady* Action = WeakThis.Get())
+            {
+                Action->TimeoutHandle.Reset();
+                Action->Finish(EOS_EResult::EOS_TimedOut);
+            }
+            return false;
+        }), TimeoutSeconds);
+    }
+}
+
+void UAsyncWaitForAllPlayersReady::Cleanup()
+{
+    if (UEOSLobbyManager* LobbyManager = GetLobbyManager())
+    {
+        LobbyManager->OnAllPlayersReady.RemoveDynamic(this, &UAsyncWaitForAllPlayersReady::HandleAllPlayersReady);
+        LobbyManager->OnLobbyLeft.RemoveDynamic(this, &UAsyncWaitForAllPlayersReady::HandleLobbyLeft);
+    }
+
+    if (TimeoutHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(TimeoutHandle);
+        TimeoutHandle.Reset();
+    }
+}
+
+void UAsyncWaitForAllPlayersReady::HandleAllPlayersReady()
+{
+    UEOSLobbyManager* LobbyManager = GetLobbyManager();
+    Finish(EOS_EResult::EOS_Success, LobbyManager ? LobbyManager->GetCurrentLobbyId() : FString());
+}
+
+void UAsyncWaitForAllPlayersReady::HandleLobbyLeft()
+{
+    Finish(EOS_EResult::EOS_NotFound);
+}
+
+UAsyncWaitForSessionAddress* UAsyncWaitForSessionAddress::WaitForSessionAddress(UObject* WorldContextObject)
+{
+    UAsyncWaitForSessionAddress* Action = NewObject<UAsyncWaitForSessionAddress>();
+    Action->Setup(WorldContextObject);
+    return Action;
+}
+
+void UAsyncWaitForSessionAddress::Start()
+{
+    UEOSLobbyManager* LobbyManager = GetLobbyManager();
+    if (!LobbyManager || !LobbyManager->IsInLobby())
+    {
+        Finish(EOS_EResult::EOS_NotFound);
+        return;
+    }
+
+    const FString SessionAddress = LobbyManager->GetLobbySessionAddress();
+    if (!SessionAddress.IsEmpty())
+    {
+        Finish(EOS_EResult::EOS_Success, SessionAddress);
+        return;
+    }
+
+    LobbyManager->OnSessionAddressUpdated.AddDynamic(this, &UAsyncWaitForSessionAddress::HandleSessionAddressUpdated);
+    LobbyManager->OnLobbyLeft.AddDynamic(this, &UAsyncWaitForSessionAddress::HandleLobbyLeft);
+}
+
+void UAsyncWaitForSessionAddress::Cleanup()
+{
+    if (UEOSLobbyManager* LobbyManager = GetLobbyManager())
+    {
+        LobbyManager->OnSessionAddressUpdated.RemoveDynamic(this, &UAsyncWaitForSessionAddress::HandleSessionAddressUpdated);
+        LobbyManager->OnLobbyLeft.RemoveDynamic(this, &UAsyncWaitForSessionAddress::HandleLobbyLeft);
+    }
+}
+
+void UAsyncWaitForSessionAddress::HandleSessionAddressUpdated(const FString& SessionAddress)
+{
+    if (!SessionAddress.IsEmpty())
+    {
+        Finish(EOS_EResult::EOS_Success, SessionAddress);
+    }
+}
+
+void UAsyncWaitForSessionAddress::HandleLobbyLeft()
+{
+    Finish(EOS_EResult::EOS_NotFound);
+}
+
+// ---------------------------------------------------------------
+// Session
+// ---------------------------------------------------------------
+
+void USessionOperationAsyncAction::Start()
+{
+    UEOSSessionManager* SessionManager = GetSessionManager();
+    if (!SessionManager)
+    {
+        Finish(EOS_EResult::EOS_InvalidState);
+        return;
+    }
+
+    OperationHandle = SessionManager->OnSessionOperationComplete.AddUObject(this, &USessionOperationAsyncAction::HandleOperationComplete);
+    bCalling = true;
+    RequestId = Call(SessionManager);
+    bCalling = false;
+
+    if (const FMatchmakingResult* Early = ResultsDuringCall.Find(RequestId))
+    {
+        Finish(Early->Result, Early->Id);
+    }
+    ResultsDuringCall.Reset();
+}
+
+void USessionOperationAsyncAction::Cleanup()
+{
+    if (UEOSSessionManager* SessionManager = GetSessionManager())
+    {
+        SessionManager->OnSessionOperationComplete.Remove(OperationHandle);
+    }
+    OperationHandle.Reset();
+}
+
+void USessionOperationAsyncAction::HandleOperationComplete(ESessionOperation Operation, EOS_EResult Result, const FString& SessionId, int32 InRequestId)
+{
+    if (Operation != GetOperation())
+    {
+        return;
+    }
+
+    if (bCalling && InRequestId != 0)
+    {
+        ResultsDuringCall.Add(InRequestId, FMatchmakingResult{ Result, SessionId });
+        return;
+    }
+
+    if (!IsOwnResult(InRequestId, SessionId))
+    {
+        return;
+    }
+
+    // The session manager travels on this one as well (PIE with the same account)
+    if (Operation == ESessionOperation::Join && Result == EOS_EResult::EOS_Sessions_SessionAlreadyExists)
+    {
+        Result = EOS_EResult::EOS_Success;
+    }
+    Finish(Result, SessionId);
+}
+
+UAsyncCreateSession* UAsyncCreateSession::CreateSessionAsync(UObject* WorldContextObject, const FString& SessionName, int32 MaxPlayers)
+{
+    UAsyncCreateSession* Action = NewObject<UAsyncCreateSession>();
+    Action->SessionName = SessionName;
+    Action->MaxPlayers = MaxPlayers;
+    Action->Setup(WorldContextObject);
+    return Action;
+}
+
+UAsyncJoinSession* UAsyncJoinSession::JoinSessionAsync(UObject* WorldContextObject, const FString& SessionId)
+{
+    UAsyncJoinSession* Action = NewObject<UAsyncJoinSession>();
+    Action->SessionId = SessionId;
+    Action->Setup(WorldContextObject);
+    return Action;
+}
+
+UAsyncDestroySession* UAsyncDestroySession::DestroySessionAsync(UObject* WorldContextObject)
+{
+    UAsyncDestroySession* Action = NewObject<UAsyncDestroySession>();
+    Action->Setup(WorldContextObject);
+    return Action;
+}
@@ -0,0 +1,95 @@
+#include "Async/MatchmakingFutures.h"
+
+namespace MatchmakingFutures
+{
+    TFuture<FMatchmakingResult> CreateLobby(UObject* WorldContextObject, const FLobbySettings& Settings)
+    {
+        return UAsyncCreateLobby::CreateLobbyAsync(WorldContextObject, Settings)->ActivateAsFuture();
+    }
+
+    TFuture<FMatchmakingResult> JoinLobby(UObject* WorldContextObject, const FString& LobbyId)
+    {
+        return UAsyncJoinLobby::JoinLobbyAsync(WorldContextObject, LobbyId)->ActivateAsFuture();
+    }
+
+    TFuture<FMatchmakingResult> LeaveLobby(UObject* WorldContextObject)
+    {
+        return UAsyncLeaveLobby::LeaveLobbyAsync(WorldContextObject)->ActivateAsFuture();
+    }
+
+    TFuture<FMatchmakingResult> DestroyLobby(UObject* WorldContextObject)
+    {
+        return UAsyncDestroyLobby::DestroyLobbyAsync(WorldContextObject)->ActivateAsFuture();
+    }
+
+    TFuture<FMatchmakingResult> SetLobbyAttribute(UObject* WorldContextObject, ELobbyAttributeScope Scope, const FString& Key, const FLobbyAttributeValue& Value)
+    {
+        return UAsyncSetLobbyAttribute::SetLobbyAttributeAsync(WorldContextObject, Scope, Key, Value)->ActivateAsFuture();
+    }
+
+    TFuture<FMatchmakingResult> QuickMatch(UObject* WorldContextObject, const FQuickMatchSettings& Settings)
+    {
+        return UAsyncQuickMatch::QuickMatchAsync(WorldContextObject, Settings)->ActivateAsFuture();
+    }
+
+    TFuture<FMatchmakingResult> WaitForAllPlayersReady(UObject* WorldContextObject, float TimeoutSeconds)
+    {
+        return UAsyncWaitForAllPlayersReady::WaitForAllPlayersReady(WorldContextObject, TimeoutSeconds)->ActivateAsFuture();
+    }
+
+    TFuture<FMatchmakingResult> WaitForSessionAddress(UObject* WorldContextObject)
+    {
+        return UAsyncWaitForSessionAddress::WaitForSessionAddress(WorldContextObject)->ActivateAsFuture();
+    }
+
+    TFuture<FMatchmakingResult> CreateSession(UObject* WorldContextObject, const FString& SessionName, int32 MaxPlayers)
+    {
+        return UAsyncCreateSession::CreateSessionAsync(WorldContextObject, SessionName, MaxPlayers)->ActivateAsFuture();
+    }
+
+    TFuture<FMatchmakingResult> JoinSession(UObject* WorldContextObject, const FString& SessionId)
+    {
+        return UAsyncJoinSession::JoinSessionAsync(WorldContextObject, SessionId)->ActivateAsFuture();
+    }
+
+    TFuture<FMatchmakingResult> DestroySession(UObject* WorldContextObject)
+    {
+        return UAsyncDestroySession::DestroySessionAsync(WorldContextObject)->ActivateAsFuture();
+    }
+
+    TFuture<TArray<FMatchmakingResult>> WhenAll(TArray<TFuture<FMatchmakingResult>>&& Futures)
+    {
+        struct FState
+        {
+            TPromise<TArray<FMatchmakingResult>> Promise;
+            TArray<FMatchmakingResult> Results;
+            int32 Remaining = 0;
+        };
+
+        TSharedRef<FState> State = MakeShared<FState>();
+        TFuture<TArray<FMatchmakingResult>> Future = State->Promise.GetFuture();
+
+        if (Futures.Num() == 0)
+        {
+            State->Promise.SetValue(TArray<FMatchmakingResult>());
+            return Future;
+        }
+
+        State->Results.SetNum(Futures.Num());
+        State->Remaining = Futures.Num();
+
+        for (int32 Index = 0; Index < Futures.Num(); Index++)
+        {
+            Futures[Index].Next([State, Index](FMatchmakingResult Result)
+            {
+                State->Results[Index] = MoveTemp(Result);
+                if (--State->Remaining == 0)
+                {
+                    State->Promise.SetValue(MoveTemp(State->Results));
+                }
+            });
+        }
+
+        return Future;
+    }
+}
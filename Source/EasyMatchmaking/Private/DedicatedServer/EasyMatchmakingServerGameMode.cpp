@@ -1,11 +1,38 @@
 #include "DedicatedServer/EasyMatchmakingServerGameMode.h"
 #include "EOSManager.h"
 #include "EasyMatchmakingLog.h"
+#include "Kismet/GameplayStatics.h"
+#include "TimerManager.h"
 
 void AEasyMatchmakingServerGameMode::BeginPlay()
 {
     Super::BeginPlay();
     InitServer();
+
+    GetWorldTimerManager().SetTimer(MatchPassTimer, this, &AEasyMatchmakingServerGameMode::RunSkillMatchPass, MatchPassInterval, true);
+}
+
+void AEasyMatchmakingServerGameMode::InitGame(const FString& MapName, const FString& Options, FString& ErrorMessage)
+{
+    Super::InitGame(MapName, Options, ErrorMessage);
+
+    // Before the first player logs in
+    FSkillMatchmakerConfig SkillConfig;
+    SkillConfig.MatchSize = SkillMatchSize;
+    SkillConfig.InitialWindow = SkillWindow;
+    SkillConfig.WindowGrowthPerSecond = SkillWindowGrowthPerSecond;
+    SkillConfig.MaxWindow = FMath::Max(SkillWindow, MaxSkillWindow);
+    SkillMatchmaker = FSkillMatchmaker(SkillConfig);
+    TicketPlayers.Reset();
+}
+
+void AEasyMatchmakingServerGameMode::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    GetWorldTimerManager().ClearTimer(MatchPassTimer);
+    SkillMatchmaker.Reset();
+    TicketPlayers.Reset();
+
+    Super::EndPlay(EndPlayReason);
 }
 
 void AEasyMatchmakingServerGameMode::InitServer()
@@ -23,3 +50,68 @@ void AEasyMatchmakingServerGameMode::InitServer()
     }
 }
 
+FString AEasyMatchmakingServerGameMode::InitNewPlayer(APlayerController* NewPlayerController, const FUniqueNetIdRepl& UniqueId, const FString& Options, const FString& Portal)
+{
+    const FString Error = Super::InitNewPlayer(NewPlayerController, UniqueId, Options, Portal);
+    if (!Error.IsEmpty() || !NewPlayerController || !UGameplayStatics::HasOption(Options, TEXT("Rating")))
+    {
+        return Error;
+    }
+
+    // Sent by clients that called SetPlayerRating before traveling here
+    double Rating = 0.0;
+    LexFromString(Rating, *UGameplayStatics::ParseOption(Options, TEXT("Rating")));
+
+    const int32 TicketId = SkillMatchmaker.AddTicket(UniqueId.IsValid() ? UniqueId.ToString() : FString(), Rating, 1, GetWorld()->GetTimeSeconds());
+    if (TicketId != INDEX_NONE)
+    {
+        TicketPlayers.Add(TicketId, NewPlayerController);
+        EM_LOG_INFO(TEXT("Queued player with rating %.0f (%d waiting)"), Rating, SkillMatchmaker.Num());
+    }
+    return Error;
+}
+
+void AEasyMatchmakingServerGameMode::Logout(AController* Exiting)
+{
+    for (auto It = TicketPlayers.CreateIterator(); It; ++It)
+    {
+        if (It->Value.Get() == Exiting)
+        {
+            SkillMatchmaker.RemoveTicket(It->Key);
+            It.RemoveCurrent();
+            break;
+        }
+    }
+
+    Super::Logout(Exiting);
+}
+
+void AEasyMatchmakingServerGameMode::RunSkillMatchPass()
+{
+    if (SkillMatchmaker.Num() < SkillMatchmaker.GetConfig().MatchSize)
+    {
+        return;
+    }
+
+    TArray<FSkillMatch> Matches;
+    if (SkillMatchmaker.RunMatchPass(GetWorld()->GetTimeSeconds(), Matches) == 0)
+    {
+        return;
+    }
+
+    for (const FSkillMatch& Match : Matches)
+    {
+        TArray<APlayerController*> Players;
+        for (const FSkillTicket& Ticket : Match.Tickets)
+        {
+            TWeakObjectPtr<APlayerController> Player;
+            if (TicketPlayers.RemoveAndCopyValue(Ticket.TicketId, Player) && Player.IsValid())
+            {
+                Players.Add(Player.Get());
+            }
+        }
+
+        EM_LOG_INFO(TEXT("Skill match formed: %d players, rating %.0f - %.0f"), Players.Num(), Match.MinRating, Match.MaxRating);
+        OnSkillMatchFormed.Broadcast(Players, Match.MinRating, Match.MaxRating);
+    }
+}
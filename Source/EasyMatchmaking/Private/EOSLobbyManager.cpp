@@ -5,10 +5,44 @@
 #include <eos_userinfo.h>
 #include <eos_lobby.h>
 
+#include "Async/EOSOperationRunner.h"
+#include "Async/EOSOperationTracker.h"
 #include "EasyMatchmakingLog.h"
+#include "EasyMatchmakingSettings.h"
+#include "Lobby/LobbySummary.h"
+#include "Lobby/SessionJoinSchedule.h"
+#include "Matchmaking/RegionLatency.h"
+#include "Matchmaking/SkillMatchmaker.h"
 #include "EOSManager.h"
 #include "IEOSSDKManager.h"
 
+namespace
+{
+    EOS_ELobbyPermissionLevel GetPermissionLevel(const FLobbySettings& Settings)
+    {
+        switch (Settings.Permission)
+        {
+        case ELobbyPermission::JoinViaPresence:
+            return EOS_ELobbyPermissionLevel::EOS_LPL_JOINVIAPRESENCE;
+        case ELobbyPermission::InviteOnly:
+            return EOS_ELobbyPermissionLevel::EOS_LPL_INVITEONLY;
+        default:
+            return Settings.bIsPrivate ? EOS_ELobbyPermissionLevel::EOS_LPL_INVITEONLY : EOS_ELobbyPermissionLevel::EOS_LPL_PUBLICADVERTISED;
+        }
+    }
+
+    // Written by the plugin itself, initial attributes can't override them
+    bool IsReservedLobbyKey(const FString& Key)
+    {
+        return Key == LobbyAttributeKeys::Summary
+            || Key == LobbyAttributeKeys::Region
+            || Key == LobbyAttributeKeys::Rating
+            || Key == LobbyAttributeKeys::SessionAddress
+            || Key == LobbyAttributeKeys::SessionServer
+            || Key == LobbyAttributeKeys::Ready;
+    }
+}
+
 void UEOSLobbyManager::Init(void* InPlatformHandle, void* InLobbyHandle, void* InLocalUserId, UEOSManager* InManager)
 {
     PlatformHandle = static_cast<EOS_HPlatform>(InPlatformHandle);
@@ -18,6 +52,11 @@ void UEOSLobbyManager::Init(void* InPlatformHandle, void* InLobbyHandle, void* I
 
     LocalEpicAccountId = EOSManager->GetCurrentEpicAccountId();
 
+    DisplayNameResolver->Init(PlatformHandle, LocalUserId, LocalEpicAccountId, EOSManager->GetCircuitBreaker());
+    DisplayNameResolver->OnResolved.BindUObject(this, &UEOSLobbyManager::HandleDisplayNamesResolved);
+    DisplayNameResolver->LoadCache();
+    DisplayNameResolver->Flush();
+
     if (PlatformHandle && LobbyHandle)
     {
         EM_LOG_INFO(TEXT("EOSLobbyManager initialized successfully"));
@@ -44,15 +83,24 @@ void UEOSLobbyManager::BeginDestroy()
     UnregisterLobbyNotifications();
 
     // Clear all cached data
-    LobbyMembers.Empty();
+    LobbyMembers.Reset();
     FoundLobbies.Empty();
+    ResetLobbySnapshot();
+
+    ReleaseLobbySearch(BrowserSearch);
+    ReleaseCachedLobbyDetails();
+    ReleaseLobbySearch(QuickMatchSearch);
+    LobbyQuickMatch::ReleaseCandidates(QuickMatchCandidates);
 
     // Cancel any pending async operations if possible
-    if (CurrentLobbySearchHandle)
+    ReleaseLobbySearch(JoinSearch);
+    TArray<TSharedRef<FLobbySearch>> Searches;
+    PendingLobbySearches.GenerateValueArray(Searches);
+    for (const TSharedRef<FLobbySearch>& Search : Searches)
     {
-        EOS_LobbySearch_Release(CurrentLobbySearchHandle);
-        CurrentLobbySearchHandle = nullptr;
+        Search->Cancel();
     }
+    PendingLobbySearches.Reset();
 
 	UObject::BeginDestroy();
 }
@@ -138,22 +186,38 @@ void UEOSLobbyManager::UnregisterLobbyNotifications()
     }
 }
 
-void UEOSLobbyManager::CreateLobby(const FLobbySettings& Settings)
+int32 UEOSLobbyManager::CreateLobby(const FLobbySettings& Settings)
 {
+    const int32 RequestId = NextLobbyOperationRequestId++;
     if (!LobbyHandle || !LocalUserId)
     {
         EM_LOG_ERROR(TEXT("Cannot create lobby - invalid handles or user not authenticated"));
-        return;
+        OnLobbyOperationComplete.Broadcast(ELobbyOperation::Create, EOS_EResult::EOS_InvalidUser, FString(), RequestId);
+        return RequestId;
     }
 
     if (bIsInLobby)
     {
         EM_LOG_WARNING(TEXT("Already in a lobby. Leave current lobby first."));
-        return;
+        OnLobbyOperationComplete.Broadcast(ELobbyOperation::Create, EOS_EResult::EOS_InvalidState, CurrentLobbyId, RequestId);
+        return RequestId;
+    }
+
+    if (CreateRequestId != 0)
+    {
+        EM_LOG_WARNING(TEXT("A lobby is already being created"));
+        OnLobbyOperationComplete.Broadcast(ELobbyOperation::Create, EOS_EResult::EOS_AlreadyPending, FString(), RequestId);
+        return RequestId;
     }
 
+    CancelLobbyRejoin();
+
     // Store settings
     CurrentSettings = Settings;
+    if (CurrentSettings.Region.IsEmpty())
+    {
+        CurrentSettings.Region = RegionLatency::GetBestRegion(GetRegionLatencies());
+    }
 
     // Log the exact user ID being used
     char UserIdStr[EOS_PRODUCTUSERID_MAX_LENGTH + 1];
@@ -161,21 +225,6 @@ void UEOSLobbyManager::CreateLobby(const FLobbySettings& Settings)
     EOS_ProductUserId_ToString(LocalUserId, UserIdStr, &BufferSize);
     EM_LOG_INFO(TEXT("Initializing lobby with ProductUserId: %s"), UTF8_TO_TCHAR(UserIdStr));
 
-    EOS_Lobby_CreateLobbyOptions CreateOptions = {};
-    CreateOptions.ApiVersion = EOS_LOBBY_CREATELOBBY_API_LATEST;
-    CreateOptions.LocalUserId = LocalUserId;
-    CreateOptions.MaxLobbyMembers = Settings.MaxPlayers;
-    CreateOptions.PermissionLevel = EOS_ELobbyPermissionLevel::EOS_LPL_PUBLICADVERTISED;
-    CreateOptions.bPresenceEnabled = EOS_FALSE;
-    CreateOptions.bAllowInvites = EOS_TRUE;
-    CreateOptions.bDisableHostMigration = EOS_FALSE;
-    CreateOptions.LobbyId = nullptr; 
-    CreateOptions.bEnableRTCRoom = EOS_FALSE;  
-    CreateOptions.LocalRTCOptions = nullptr;  
-
-    FTCHARToUTF8 BucketIdConverter(*Settings.BucketId);
-    CreateOptions.BucketId = BucketIdConverter.Get();
-
     EM_LOG_INFO(TEXT("=== EOS PLATFORM DEBUG INFO ==="));
 
     // Get the current platform config
@@ -198,7 +247,35 @@ void UEOSLobbyManager::CreateLobby(const FLobbySettings& Settings)
         }
     }
 
-    EOS_Lobby_CreateLobby(LobbyHandle, &CreateOptions, this, OnCreateLobbyComplete);
+    const int32 MaxLobbyMembers = Settings.MaxPlayers;
+    const FString BucketId = Settings.BucketId;
+    const EOS_ELobbyPermissionLevel PermissionLevel = GetPermissionLevel(Settings);
+
+    // Set first, EOS may answer before Run returns
+    CreateRequestId = RequestId;
+    EOSOperationRunner::Run(EOSOperations::CreateLobby, EOSManager->GetCircuitBreaker(), this, this,
+        [this, MaxLobbyMembers, BucketId, PermissionLevel](void* OperationData, EOS_Lobby_OnCreateLobbyCallback Callback)
+        {
+            EOS_Lobby_CreateLobbyOptions CreateOptions = {};
+            CreateOptions.ApiVersion = EOS_LOBBY_CREATELOBBY_API_LATEST;
+            CreateOptions.LocalUserId = LocalUserId;
+            CreateOptions.MaxLobbyMembers = MaxLobbyMembers;
+            CreateOptions.PermissionLevel = PermissionLevel;
+            CreateOptions.bPresenceEnabled = EOS_FALSE;
+            CreateOptions.bAllowInvites = EOS_TRUE;
+            CreateOptions.bDisableHostMigration = EOS_FALSE;
+            CreateOptions.LobbyId = nullptr;
+            CreateOptions.bEnableRTCRoom = EOS_FALSE;
+            CreateOptions.LocalRTCOptions = nullptr;
+
+            FTCHARToUTF8 BucketIdConverter(*BucketId);
+            CreateOptions.BucketId = BucketIdConverter.Get();
+
+            EOS_Lobby_CreateLobby(LobbyHandle, &CreateOptions, OperationData, Callback);
+            return true;
+        },
+        OnCreateLobbyComplete);
+    return RequestId;
 }
 
 void UEOSLobbyManager::JoinLobby(const FString& LobbyId)
@@ -206,454 +283,893 @@ void UEOSLobbyManager::JoinLobby(const FString& LobbyId)
     if (!LobbyHandle || !LocalUserId)
     {
         EM_LOG_ERROR(TEXT("Cannot join lobby - invalid handles or user not authenticated"));
+        OnLobbyOperationComplete.Broadcast(ELobbyOperation::Join, EOS_EResult::EOS_InvalidUser, LobbyId, 0);
         return;
     }
 
     if (bIsInLobby)
     {
         EM_LOG_WARNING(TEXT("Already in a lobby. Leave current lobby first."));
+        OnLobbyOperationComplete.Broadcast(ELobbyOperation::Join, EOS_EResult::EOS_InvalidState, LobbyId, 0);
         return;
     }
 
     if (LobbyId.IsEmpty())
     {
         EM_LOG_ERROR(TEXT("Cannot join lobby - LobbyId is empty"));
+        OnLobbyOperationComplete.Broadcast(ELobbyOperation::Join, EOS_EResult::EOS_InvalidParameters, LobbyId, 0);
+        return;
+    }
+
+    if (IsRejoiningLobby() && LobbyId != RejoinLobbyId)
+    {
+        CancelLobbyRejoin();
+    }
+
+    // Picked from the browser, we already have its details handle
+    if (EOS_HLobbyDetails* CachedDetails = CachedLobbyDetails.Find(LobbyId))
+    {
+        EM_LOG_INFO(TEXT("Using cached lobby details for join: %s"), *LobbyId);
+        ReleaseLobbySearch(JoinSearch);
+        JoinLobbyWithDetails(*CachedDetails);
         return;
     }
 
+#if defined(EOS_LOBBY_JOINLOBBYBYID_API_LATEST)
+    // Not in the browser list (invite, typed in id), join by id without a lookup
+    ReleaseLobbySearch(JoinSearch);
+
+    EM_LOG_INFO(TEXT("Joining lobby by id: %s"), *LobbyId);
+    EOSOperationRunner::Run(EOSOperations::JoinLobbyById, EOSManager->GetCircuitBreaker(), this, this,
+        [this, LobbyId](void* OperationData, EOS_Lobby_OnJoinLobbyByIdCallback Callback)
+        {
+            FTCHARToUTF8 LobbyIdConverter(*LobbyId);
+            EOS_Lobby_JoinLobbyByIdOptions JoinOptions = {};
+            JoinOptions.ApiVersion = EOS_LOBBY_JOINLOBBYBYID_API_LATEST;
+            JoinOptions.LobbyId = LobbyIdConverter.Get();
+            JoinOptions.LocalUserId = LocalUserId;
+
+            EOS_Lobby_JoinLobbyById(LobbyHandle, &JoinOptions, OperationData, Callback);
+            return true;
+        },
+        OnJoinLobbyByIdComplete);
+#else
     // Search for the specific lobby to get its details handle
-    EOS_Lobby_CreateLobbySearchOptions SearchOptions = {};
-    SearchOptions.ApiVersion = EOS_LOBBY_CREATELOBBYSEARCH_API_LATEST;
-    SearchOptions.MaxResults = 1;
+    FLobbySearchParams Params;
+    Params.LobbyId = LobbyId;
+
+    if (JoinSearch.IsValid())
+    {
+        if (JoinSearch->GetKey() == Params.MakeKey() && !JoinSearch->IsFound())
+        {
+            EM_LOG_INFO(TEXT("Already looking up lobby %s"), *LobbyId);
+            return;
+        }
 
-    EOS_EResult Result = EOS_Lobby_CreateLobbySearch(LobbyHandle, &SearchOptions, &CurrentLobbySearchHandle);
+        // Player picked another lobby, the old lookup is not needed anymore
+        ReleaseLobbySearch(JoinSearch);
+    }
 
-    if (Result == EOS_EResult::EOS_Success && CurrentLobbySearchHandle)
+    JoinSearch = AcquireLobbySearch(Params);
+    if (!JoinSearch.IsValid())
     {
-        // Set the specific lobby ID to search for
-        FTCHARToUTF8 LobbyIdConverter(*LobbyId);
-        EOS_LobbySearch_SetLobbyIdOptions SetLobbyIdOptions = {};
-        SetLobbyIdOptions.ApiVersion = EOS_LOBBYSEARCH_SETLOBBYID_API_LATEST;
-        SetLobbyIdOptions.LobbyId = LobbyIdConverter.Get();
+        EM_LOG_ERROR(TEXT("Failed to create lobby search for joining"));
+        OnLobbyOperationComplete.Broadcast(ELobbyOperation::Join, EOS_EResult::EOS_UnexpectedError, LobbyId, 0);
+        return;
+    }
+
+    EM_LOG_INFO(TEXT("Searching for lobby to join: %s"), *LobbyId);
+    JoinSearch->OnFound.AddUObject(this, &UEOSLobbyManager::HandleJoinSearchFound, JoinSearch.ToWeakPtr());
+#endif
+}
 
-        EOS_LobbySearch_SetLobbyId(CurrentLobbySearchHandle, &SetLobbyIdOptions);
+void UEOSLobbyManager::HandleJoinSearchFound(EOS_EResult Result, TWeakPtr<FLobbySearch> WeakSearch)
+{
+    TSharedPtr<FLobbySearch> Search = WeakSearch.Pin();
+    if (!Search.IsValid())
+    {
+        return;
+    }
 
-        // Execute search to get lobby details
-        EOS_LobbySearch_FindOptions FindOptions = {};
-        FindOptions.ApiVersion = EOS_LOBBYSEARCH_FIND_API_LATEST;
-        FindOptions.LocalUserId = LocalUserId;
+    if (Result == EOS_EResult::EOS_Canceled)
+    {
+        if (JoinSearch == Search)
+        {
+            JoinSearch.Reset();
+        }
+        return;
+    }
 
-        EM_LOG_INFO(TEXT("Searching for lobby to join: %s"), *LobbyId);
-        EOS_LobbySearch_Find(CurrentLobbySearchHandle, &FindOptions, this, OnFindLobbyToJoinComplete);
+    EOS_HLobbyDetails LobbyDetails = (Result == EOS_EResult::EOS_Success) ? Search->CopyResultDetails(0) : nullptr;
+    if (LobbyDetails)
+    {
+        EM_LOG_INFO(TEXT("Joining lobby with valid details handle"));
+        JoinLobbyWithDetails(LobbyDetails);
+        EOS_LobbyDetails_Release(LobbyDetails);
     }
     else
     {
-        EM_LOG_ERROR(TEXT("Failed to create lobby search for joining"));
+        EM_LOG_ERROR(TEXT("Failed to find lobby to join: %s"), UTF8_TO_TCHAR(EOS_EResult_ToString(Result)));
+        const EOS_EResult JoinResult = Result == EOS_EResult::EOS_Success ? EOS_EResult::EOS_NotFound : Result;
+        if (IsRejoiningLobby() && RejoinLobbyId == Search->GetParams().LobbyId)
+        {
+            HandleLobbyRejoinFailed(JoinResult);
+        }
+        OnLobbyOperationComplete.Broadcast(ELobbyOperation::Join, JoinResult, Search->GetParams().LobbyId, 0);
+    }
+
+    if (JoinSearch == Search)
+    {
+        ReleaseLobbySearch(JoinSearch);
     }
 }
 
-void UEOSLobbyManager::LeaveLobby()
+void UEOSLobbyManager::JoinLobbyWithDetails(EOS_HLobbyDetails LobbyDetails)
+{
+    // The details handle belongs to the caller, this one is sent only once
+    EOSOperationRunner::Run(EOSOperations::JoinLobby, EOSManager->GetCircuitBreaker(), this, this,
+        [this, LobbyDetails](void* OperationData, EOS_Lobby_OnJoinLobbyCallback Callback)
+        {
+            EOS_Lobby_JoinLobbyOptions JoinOptions = {};
+            JoinOptions.ApiVersion = EOS_LOBBY_JOINLOBBY_API_LATEST;
+            JoinOptions.LocalUserId = LocalUserId;
+            JoinOptions.LobbyDetailsHandle = LobbyDetails;
+
+            EOS_Lobby_JoinLobby(LobbyHandle, &JoinOptions, OperationData, Callback);
+            return true;
+        },
+        OnJoinLobbyComplete);
+}
+
+int32 UEOSLobbyManager::LeaveLobby()
 {
+    const int32 RequestId = NextLobbyOperationRequestId++;
     if (!LobbyHandle || !LocalUserId)
     {
         EM_LOG_ERROR(TEXT("Cannot leave lobby - invalid handles"));
-        return;
+        OnLobbyOperationComplete.Broadcast(ELobbyOperation::Leave, EOS_EResult::EOS_InvalidUser, CurrentLobbyId, RequestId);
+        return RequestId;
     }
 
     if (!bIsInLobby || CurrentLobbyId.IsEmpty())
     {
         EM_LOG_WARNING(TEXT("Not currently in a lobby"));
-        return;
+        OnLobbyOperationComplete.Broadcast(ELobbyOperation::Leave, EOS_EResult::EOS_NotFound, CurrentLobbyId, RequestId);
+        return RequestId;
     }
 
-    EOS_Lobby_LeaveLobbyOptions LeaveOptions = {};
-    LeaveOptions.ApiVersion = EOS_LOBBY_LEAVELOBBY_API_LATEST;
-    LeaveOptions.LocalUserId = LocalUserId;
-
-    FTCHARToUTF8 LobbyIdConverter(*CurrentLobbyId);
-    LeaveOptions.LobbyId = LobbyIdConverter.Get();
+    if (LeaveRequestId != 0)
+    {
+        EM_LOG_WARNING(TEXT("Lobby leave already in progress"));
+        OnLobbyOperationComplete.Broadcast(ELobbyOperation::Leave, EOS_EResult::EOS_AlreadyPending, CurrentLobbyId, RequestId);
+        return RequestId;
+    }
 
     EM_LOG_INFO(TEXT("Leaving lobby: %s"), *CurrentLobbyId);
 
-    EOS_Lobby_LeaveLobby(LobbyHandle, &LeaveOptions, this, OnLeaveLobbyComplete);
+    LeaveRequestId = RequestId;
+    EOSOperationRunner::Run(EOSOperations::LeaveLobby, EOSManager->GetCircuitBreaker(), this, this,
+        [this, LobbyId = CurrentLobbyId](void* OperationData, EOS_Lobby_OnLeaveLobbyCallback Callback)
+        {
+            EOS_Lobby_LeaveLobbyOptions LeaveOptions = {};
+            LeaveOptions.ApiVersion = EOS_LOBBY_LEAVELOBBY_API_LATEST;
+            LeaveOptions.LocalUserId = LocalUserId;
+
+            FTCHARToUTF8 LobbyIdConverter(*LobbyId);
+            LeaveOptions.LobbyId = LobbyIdConverter.Get();
+
+            EOS_Lobby_LeaveLobby(LobbyHandle, &LeaveOptions, OperationData, Callback);
+            return true;
+        },
+        OnLeaveLobbyComplete);
+    return RequestId;
 }
 
-void UEOSLobbyManager::DestroyLobby()
+int32 UEOSLobbyManager::DestroyLobby()
 {
+    const int32 RequestId = NextLobbyOperationRequestId++;
     if (!LobbyHandle || !LocalUserId)
     {
         EM_LOG_ERROR(TEXT("Cannot destroy lobby - invalid handles"));
-        return;
+        OnLobbyOperationComplete.Broadcast(ELobbyOperation::Destroy, EOS_EResult::EOS_InvalidUser, CurrentLobbyId, RequestId);
+        return RequestId;
     }
 
     if (!bIsInLobby || CurrentLobbyId.IsEmpty())
     {
         EM_LOG_WARNING(TEXT("Not currently in a lobby to destroy"));
-        return;
+        OnLobbyOperationComplete.Broadcast(ELobbyOperation::Destroy, EOS_EResult::EOS_NotFound, CurrentLobbyId, RequestId);
+        return RequestId;
     }
 
-    EOS_Lobby_DestroyLobbyOptions DestroyOptions = {};
-    DestroyOptions.ApiVersion = EOS_LOBBY_DESTROYLOBBY_API_LATEST;
-    DestroyOptions.LocalUserId = LocalUserId;
-
-    FTCHARToUTF8 LobbyIdConverter(*CurrentLobbyId);
-    DestroyOptions.LobbyId = LobbyIdConverter.Get();
+    if (DestroyRequestId != 0)
+    {
+        EM_LOG_WARNING(TEXT("Lobby destroy already in progress"));
+        OnLobbyOperationComplete.Broadcast(ELobbyOperation::Destroy, EOS_EResult::EOS_AlreadyPending, CurrentLobbyId, RequestId);
+        return RequestId;
+    }
 
     EM_LOG_INFO(TEXT("Destroying lobby: %s"), *CurrentLobbyId);
 
-    EOS_Lobby_DestroyLobby(LobbyHandle, &DestroyOptions, this, OnDestroyLobbyComplete);
+    DestroyRequestId = RequestId;
+    EOSOperationRunner::Run(EOSOperations::DestroyLobby, EOSManager->GetCircuitBreaker(), this, this,
+        [this, LobbyId = CurrentLobbyId](void* OperationData, EOS_Lobby_OnDestroyLobbyCallback Callback)
+        {
+            EOS_Lobby_DestroyLobbyOptions DestroyOptions = {};
+            DestroyOptions.ApiVersion = EOS_LOBBY_DESTROYLOBBY_API_LATEST;
+            DestroyOptions.LocalUserId = LocalUserId;
+
+            FTCHARToUTF8 LobbyIdConverter(*LobbyId);
+            DestroyOptions.LobbyId = LobbyIdConverter.Get();
+
+            EOS_Lobby_DestroyLobby(LobbyHandle, &DestroyOptions, OperationData, Callback);
+            return true;
+        },
+        OnDestroyLobbyComplete);
+    return RequestId;
+}
+
+int32 UEOSLobbyManager::SearchLobbies(const FString& BucketId)
+{
+    return SearchLobbiesFiltered(BucketId, TArray<FLobbySearchFilter>(), 0);
 }
 
-void UEOSLobbyManager::SearchLobbies(const FString& BucketId)
+int32 UEOSLobbyManager::SearchLobbiesFiltered(const FString& BucketId, const TArray<FLobbySearchFilter>& Filters, int32 MinAvailableSlots)
 {
     if (!LobbyHandle || !LocalUserId)
     {
         EM_LOG_ERROR(TEXT("Cannot search lobbies - invalid handles"));
-        return;
+        return INDEX_NONE;
     }
 
-    FoundLobbies.Empty();
-
-    // Create lobby search handle
-    EOS_Lobby_CreateLobbySearchOptions SearchOptions = {};
-    SearchOptions.ApiVersion = EOS_LOBBY_CREATELOBBYSEARCH_API_LATEST;
-    SearchOptions.MaxResults = 50;
+    const UEasyMatchmakingSettings* Settings = UEasyMatchmakingSettings::Get();
 
-    EOS_EResult Result = EOS_Lobby_CreateLobbySearch(LobbyHandle, &SearchOptions, &CurrentLobbySearchHandle);
+    FLobbySearchParams Params;
+    Params.BucketId = BucketId;
+    Params.MaxResults = Settings->LobbySearchMaxResults;
+    Params.MinAvailableSlots = MinAvailableSlots;
+    Params.Filters = Filters;
 
-    if (Result == EOS_EResult::EOS_Success && CurrentLobbySearchHandle)
+    // Refresh spam: the same search is still waiting on the backend, its results will come
+    if (BrowserSearch.IsValid() && !BrowserSearch->IsFound() && BrowserSearch->GetKey() == Params.MakeKey())
     {
-        if (!BucketId.IsEmpty())
-        {
-            FTCHARToUTF8 BucketIdConverter(*BucketId);
-
-            EOS_Lobby_AttributeData BucketAttribute = {};
-            BucketAttribute.ApiVersion = EOS_LOBBY_ATTRIBUTEDATA_API_LATEST;
-            BucketAttribute.Key = "bucket";
-            BucketAttribute.Value.AsUtf8 = BucketIdConverter.Get();
-            BucketAttribute.ValueType = EOS_ELobbyAttributeType::EOS_AT_STRING;
-
-            EOS_LobbySearch_SetParameterOptions SetParamOptions = {};
-            SetParamOptions.ApiVersion = EOS_LOBBYSEARCH_SETPARAMETER_API_LATEST;
-            SetParamOptions.Parameter = &BucketAttribute;
-            SetParamOptions.ComparisonOp = EOS_EComparisonOp::EOS_CO_EQUAL;
-
-            EOS_LobbySearch_SetParameter(CurrentLobbySearchHandle, &SetParamOptions);
-        }
-        // Execute search
-        EOS_LobbySearch_FindOptions FindOptions = {};
-        FindOptions.ApiVersion = EOS_LOBBYSEARCH_FIND_API_LATEST;
-        FindOptions.LocalUserId = LocalUserId;
-
-        EM_LOG_INFO(TEXT("Executing lobby search..."));
-        EOS_LobbySearch_Find(CurrentLobbySearchHandle, &FindOptions, this, OnFindLobbiesComplete);
+        EM_LOG_INFO(TEXT("Lobby search %d is already running"), BrowserSearch->GetRequestId());
+        return BrowserSearch->GetRequestId();
     }
-    else
+
+    if (CachedResultsRequestId != 0 && BrowserSearchKey == Params.MakeKey())
     {
-        EM_LOG_ERROR(TEXT("Failed to create lobby search"));
+        return CachedResultsRequestId;
     }
-}
 
-const FLobbyInfo UEOSLobbyManager::UpdateLobbyInfoData()
-{
-    if (!bIsInLobby || CurrentLobbyId.IsEmpty())
+    // A new search replaces the one the browser is paging through
+    if (BrowserSearch.IsValid())
     {
-        EM_LOG_ERROR(TEXT("Not in a lobby to refresh"));
-        return FLobbyInfo();
+        ReleaseLobbySearch(BrowserSearch);
     }
+    FoundLobbies.Empty();
+    RevalidatedLobbies.Empty();
+    bRevalidatingBrowserSearch = false;
+    CachedResultsRequestId = 0;
 
-    // Get current lobby details
-    EOS_Lobby_CopyLobbyDetailsHandleOptions CopyOptions = {};
-    CopyOptions.ApiVersion = EOS_LOBBY_COPYLOBBYDETAILSHANDLE_API_LATEST;
-    CopyOptions.LocalUserId = LocalUserId;
-
-    FTCHARToUTF8 LobbyIdConverter(*CurrentLobbyId);
-    CopyOptions.LobbyId = LobbyIdConverter.Get();
-
-    EOS_HLobbyDetails LobbyDetails = nullptr;
-    EOS_EResult Result = EOS_Lobby_CopyLobbyDetailsHandle(LobbyHandle, &CopyOptions, &LobbyDetails);
-
-    FLobbyInfo UpdatedInfo;
-    if (Result == EOS_EResult::EOS_Success && LobbyDetails)
+    // Show what we found last time right away
+    BrowserSearchKey = Params.MakeKey();
+    const FLobbySearchCache::FEntry* Cached = LobbySearchCache.Find(BrowserSearchKey);
+    if (!Cached)
+    {
+        // Rows of the old list are gone, so are their handles
+        ReleaseCachedLobbyDetails();
+    }
+    else
     {
-        // Get updated lobby info
-        EOS_LobbyDetails_CopyInfoOptions InfoOptions = {};
-        InfoOptions.ApiVersion = EOS_LOBBYDETAILS_COPYINFO_API_LATEST;
+        FoundLobbies = Cached->Lobbies;
 
-        EOS_LobbyDetails_Info* LobbyInfo = nullptr;
-		
-        if (EOS_LobbyDetails_CopyInfo(LobbyDetails, &InfoOptions, &LobbyInfo) == EOS_EResult::EOS_Success)
+        // Answered like a search that finished at once, on the next tick so the caller has the id first
+        if (LobbySearchCache.IsFresh(*Cached, Settings->LobbySearchCacheTTL))
         {
-            EM_LOG_INFO(TEXT("Current lobby refreshed: %s (Players: %d/%d)"),
-                *CurrentLobbyId,
-                LobbyInfo->MaxMembers - LobbyInfo->AvailableSlots,
-                LobbyInfo->MaxMembers);
-
-            UpdatedInfo.LobbyId = CurrentLobbyId;
-            UpdatedInfo.CurrentPlayers = LobbyInfo->MaxMembers - LobbyInfo->AvailableSlots;
-            UpdatedInfo.MaxPlayers = LobbyInfo->MaxMembers;
-            UpdatedInfo.BucketId = LobbyInfo->BucketId;
-            // Convert owner ProductUserId to string
-            if (LobbyInfo->LobbyOwnerUserId)
+            const int32 RequestId = NextLobbySearchRequestId++;
+            CachedResultsRequestId = RequestId;
+            EM_LOG_INFO(TEXT("Lobby search %d answered from cache (%d lobbies)"), RequestId, FoundLobbies.Num());
+
+            FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(this, [this, RequestId](float)
             {
-                char OwnerIdStr[EOS_PRODUCTUSERID_MAX_LENGTH + 1];
-                int32_t BufferSize = sizeof(OwnerIdStr);
-                if (EOS_ProductUserId_ToString(LobbyInfo->LobbyOwnerUserId, OwnerIdStr, &BufferSize) == EOS_EResult::EOS_Success)
-                {
-                    UpdatedInfo.OwnerUserId = UTF8_TO_TCHAR(OwnerIdStr);
-                }
-                else
+                // A newer search took over the browser
+                if (CachedResultsRequestId == RequestId)
                 {
-                    UpdatedInfo.OwnerUserId = TEXT("Unknown");
+                    CachedResultsRequestId = 0;
+                    OnLobbiesPage.Broadcast(RequestId, FoundLobbies, 0, false);
+                    OnLobbiesFound.Broadcast(FoundLobbies);
                 }
-            }
-            else
-            {
-                UpdatedInfo.OwnerUserId = TEXT("No Owner");
-            }
-
-            // Update current lobby settings
-            CurrentSettings.MaxPlayers = LobbyInfo->MaxMembers;
-
-            EOS_LobbyDetails_Info_Release(LobbyInfo);
+                return false;
+            }));
+            return RequestId;
         }
 
-        // Check for session address attribute
-        EOS_LobbyDetails_GetAttributeCountOptions AttrCountOptions = {};
-        AttrCountOptions.ApiVersion = EOS_LOBBYDETAILS_GETATTRIBUTECOUNT_API_LATEST;
-        uint32_t AttributeCount = EOS_LobbyDetails_GetAttributeCount(LobbyDetails, &AttrCountOptions);
-
-        for (uint32_t i = 0; i < AttributeCount; i++)
-        {
-            EOS_LobbyDetails_CopyAttributeByIndexOptions AttrOptions = {};
-            AttrOptions.ApiVersion = EOS_LOBBYDETAILS_COPYATTRIBUTEBYINDEX_API_LATEST;
-            AttrOptions.AttrIndex = i;
-
-            EOS_Lobby_Attribute* Attribute = nullptr;
-            EOS_EResult AttrResult = EOS_LobbyDetails_CopyAttributeByIndex(LobbyDetails, &AttrOptions, &Attribute);
-
-            if (AttrResult == EOS_EResult::EOS_Success && Attribute)
-            {
-                FString AttributeKey = UTF8_TO_TCHAR(Attribute->Data->Key);
+        OnLobbiesPage.Broadcast(INDEX_NONE, FoundLobbies, 0, false);
+        OnLobbiesFound.Broadcast(FoundLobbies);
+        bRevalidatingBrowserSearch = true;
+    }
 
-                if (AttributeKey == TEXT("session_address"))
-                {
-                    FString SessionAddress = UTF8_TO_TCHAR(Attribute->Data->Value.AsUtf8);
-                    EM_LOG_INFO(TEXT("Session address available: %s"), *SessionAddress);
+    BrowserSearch = AcquireLobbySearch(Params);
+    if (!BrowserSearch.IsValid())
+    {
+        return INDEX_NONE;
+    }
 
-                    // Broadcast to all members
-                    OnSessionAddressUpdated.Broadcast(SessionAddress);
-                }
+    BrowserSearch->OnFound.AddWeakLambda(this, [this](EOS_EResult Result)
+    {
+        if (Result == EOS_EResult::EOS_Canceled)
+        {
+            return;
+        }
 
-                EOS_Lobby_Attribute_Release(Attribute);
-            }
+        if (Result != EOS_EResult::EOS_Success)
+        {
+            EM_LOG_ERROR(TEXT("Lobby search failed: %s"), UTF8_TO_TCHAR(EOS_EResult_ToString(Result)));
+            OnLobbiesFound.Broadcast(FoundLobbies);
         }
+        EM_LOG_INFO(TEXT("Lobby search was completed"));
+    });
+    BrowserSearch->OnPage.BindUObject(this, &UEOSLobbyManager::HandleLobbiesPage);
 
-        EOS_LobbyDetails_Release(LobbyDetails);
+    // The refresh has to see every result to tell what changed
+    if (bRevalidatingBrowserSearch)
+    {
+        BrowserSearch->RequestAllPages();
     }
-    return UpdatedInfo;
+
+    return BrowserSearch->GetRequestId();
 }
 
-void UEOSLobbyManager::RegisterP2PNotifications()
+void UEOSLobbyManager::CancelLobbySearch(int32 RequestId)
 {
-    EOS_HP2P P2PHandle = EOS_Platform_GetP2PInterface(PlatformHandle);
-    if (!P2PHandle)
+    if (BrowserSearch.IsValid() && BrowserSearch->GetRequestId() == RequestId)
     {
-        EM_LOG_ERROR(TEXT("Failed to get P2P interface"));
-        return;
+        bRevalidatingBrowserSearch = false;
+        ReleaseLobbySearch(BrowserSearch);
     }
-
-    // Initialize chat socket ID
-    ChatSocketId = {};
-    ChatSocketId.ApiVersion = EOS_P2P_SOCKETID_API_LATEST;    
-    FCStringAnsi::Strncpy(ChatSocketId.SocketName, "CHAT", sizeof(ChatSocketId.SocketName) - 1); 
-
-    EM_LOG_INFO(TEXT("ChatSocketId initialized: Name=%s, ApiVersion=%d"),
-        UTF8_TO_TCHAR(ChatSocketId.SocketName),
-        ChatSocketId.ApiVersion);
-
-    EOS_P2P_AddNotifyPeerConnectionRequestOptions RequestOptions = {};
-    RequestOptions.ApiVersion = EOS_P2P_ADDNOTIFYPEERCONNECTIONREQUEST_API_LATEST;
-    RequestOptions.LocalUserId = LocalUserId;
-    RequestOptions.SocketId = &ChatSocketId;
-
-    P2PConnectionRequestNotificationId = EOS_P2P_AddNotifyPeerConnectionRequest(
-        P2PHandle,
-        &RequestOptions,
-        this,
-        OnIncomingConnectionRequest
-    );
-
-    if (P2PConnectionRequestNotificationId != EOS_INVALID_NOTIFICATIONID)
+    else if (JoinSearch.IsValid() && JoinSearch->GetRequestId() == RequestId)
     {
-        EM_LOG_INFO(TEXT("Registered P2P connection notifications (ID: %llu)"), P2PConnectionRequestNotificationId);
+        ReleaseLobbySearch(JoinSearch);
     }
-    else
+    else if (TSharedRef<FLobbySearch>* Pending = PendingLobbySearches.Find(RequestId))
     {
-        EM_LOG_ERROR(TEXT("Failed to register P2P notifications!"));
+        // Cancel fires EOS_Canceled, the listeners let go of it from there
+        TSharedRef<FLobbySearch> Search = *Pending;
+        Search->Cancel();
     }
 }
 
-void UEOSLobbyManager::RegisterTimerForTickP2PMessages(UEOSLobbyManager* LobbyManager)
+bool UEOSLobbyManager::QuickMatch(const FQuickMatchSettings& Settings)
 {
-    if (UWorld* World = GEngine->GetWorldFromContextObject(LobbyManager, EGetWorldErrorMode::LogAndReturnNull))
+    if (!LobbyHandle || !LocalUserId)
     {
-        World->GetTimerManager().SetTimer(
-            LobbyManager->ChatTickTimer,
-            LobbyManager,
-            &UEOSLobbyManager::TickP2PMessages,
-            0.1f,
-            true
-        );
+        EM_LOG_ERROR(TEXT("Cannot quick match - invalid handles or user not authenticated"));
+        return false;
     }
-}
 
-void UEOSLobbyManager::UnregisterTimerForTickP2PMessages(UEOSLobbyManager* LobbyManager)
-{
-    if (UWorld* World = GEngine->GetWorldFromContextObject(LobbyManager, EGetWorldErrorMode::LogAndReturnNull))
+    if (bIsInLobby)
     {
-        World->GetTimerManager().ClearTimer(LobbyManager->ChatTickTimer);
+        EM_LOG_WARNING(TEXT("Already in a lobby. Leave current lobby first."));
+        return false;
     }
-}
 
-bool UEOSLobbyManager::IsLobbyOwner() const
-{
-    if (!bIsInLobby || CurrentLobbyId.IsEmpty() || !LobbyHandle || !LocalUserId)
+    if (IsQuickMatchRunning())
     {
-        EM_LOG_ERROR(TEXT("IsLobbyOwner returned false because something was missing"));
+        EM_LOG_WARNING(TEXT("Quick match is already running"));
         return false;
     }
 
-    EOS_Lobby_CopyLobbyDetailsHandleOptions CopyOptions = {};
-    CopyOptions.ApiVersion = EOS_LOBBY_COPYLOBBYDETAILSHANDLE_API_LATEST;
-    CopyOptions.LocalUserId = LocalUserId;
-
-    FTCHARToUTF8 LobbyIdConverter(*CurrentLobbyId);
-    CopyOptions.LobbyId = LobbyIdConverter.Get();
-
-    EOS_HLobbyDetails LobbyDetails = nullptr;
-    EOS_EResult Result = EOS_Lobby_CopyLobbyDetailsHandle(LobbyHandle, &CopyOptions, &LobbyDetails);
-
-    bool bIsOwner = false;
-    if (Result == EOS_EResult::EOS_Success && LobbyDetails)
+    CancelLobbyRejoin();
+    QuickMatchSettings = Settings;
+    QuickMatchJoinAttempts = 0;
+    QuickMatchStartedAt = FPlatformTime::Seconds();
+    if (!StartQuickMatchSearch())
     {
-        EOS_LobbyDetails_CopyInfoOptions InfoOptions = {};
-        InfoOptions.ApiVersion = EOS_LOBBYDETAILS_COPYINFO_API_LATEST;
+        return false;
+    }
 
-        EOS_LobbyDetails_Info* LobbyInfo = nullptr;
-        if (EOS_LobbyDetails_CopyInfo(LobbyDetails, &InfoOptions, &LobbyInfo) == EOS_EResult::EOS_Success)
-        {
-            // Check if we're the owner
-            bIsOwner = (LobbyInfo->LobbyOwnerUserId == LocalUserId);
+    EM_LOG_INFO(TEXT("Quick match started (bucket: %s)"), *Settings.BucketId);
+    return true;
+}
 
-            EOS_LobbyDetails_Info_Release(LobbyInfo);
-        }
-        else
+bool UEOSLobbyManager::StartQuickMatchSearch()
+{
+    // Let the backend drop full lobbies, the rest is ranked here
+    FLobbySearchParams Params;
+    Params.BucketId = QuickMatchSettings.BucketId;
+    Params.MaxResults = QuickMatchSettings.MaxResults;
+    Params.MinAvailableSlots = FMath::Max(1, QuickMatchSettings.MinAvailableSlots);
+    Params.Filters = QuickMatchSettings.Filters;
+
+    // Same window growth as the server queue, the rating filter runs on the backend so there is no index to keep here
+    if (QuickMatchSettings.bMatchBySkill)
+    {
+        FSkillMatchmakerConfig SkillConfig;
+        SkillConfig.InitialWindow = QuickMatchSettings.SkillWindow;
+        SkillConfig.WindowGrowthPerSecond = QuickMatchSettings.SkillWindowGrowthPerSecond;
+        SkillConfig.MaxWindow = FMath::Max(QuickMatchSettings.SkillWindow, QuickMatchSettings.MaxSkillWindow);
+        QuickMatchSkillWindow = FSkillMatchmaker::GetWindow(SkillConfig, FPlatformTime::Seconds() - QuickMatchStartedAt);
+
+        Params.Filters.Add(FLobbySearchFilter::MakeRange(LobbyAttributeKeys::Rating,
+            FLobbyAttributeValue::MakeDouble(QuickMatchSettings.Rating - QuickMatchSkillWindow),
+            FLobbyAttributeValue::MakeDouble(QuickMatchSettings.Rating + QuickMatchSkillWindow)));
+    }
+
+    QuickMatchLatencyCap = 0;
+    const TMap<FString, int32>& Latencies = GetRegionLatencies();
+    const UEasyMatchmakingSettings* Settings = UEasyMatchmakingSettings::Get();
+    if (QuickMatchSettings.bMatchByLatency && Latencies.Num() > 0 && Settings->MaxLatencyMs > 0)
+    {
+        QuickMatchLatencyCap = RegionLatency::GetWidenedCap(Settings->MaxLatencyMs, Settings->LatencyWidenMsPerSecond,
+            Settings->MaxWidenedLatencyMs, FPlatformTime::Seconds() - QuickMatchStartedAt);
+
+        // Lobbies in regions too far away are never downloaded
+        const TArray<FString> Regions = RegionLatency::GetRegionsWithin(Latencies, QuickMatchLatencyCap);
+        if (Regions.Num() > 0)
         {
-			EM_LOG_ERROR(TEXT("Failed to copy lobby info to check owner"));
+            Params.Filters.Add(FLobbySearchFilter::Make(LobbyAttributeKeys::Region,
+                FLobbyAttributeValue::MakeString(FString::Join(Regions, TEXT(";"))), ELobbySearchComparison::AnyOf));
         }
+    }
 
-        EOS_LobbyDetails_Release(LobbyDetails);
+    QuickMatchSearch = AcquireLobbySearch(Params);
+    if (!QuickMatchSearch.IsValid())
+    {
+        EM_LOG_ERROR(TEXT("Failed to create lobby search for quick match"));
+        return false;
     }
 
-    return bIsOwner;
+    QuickMatchState = EQuickMatchState::Searching;
+    QuickMatchSearch->OnFound.AddUObject(this, &UEOSLobbyManager::HandleQuickMatchSearchFound, QuickMatchSearch.ToWeakPtr());
+    return true;
 }
 
-bool UEOSLobbyManager::AreAllPlayersReady() const
+void UEOSLobbyManager::RetryQuickMatchSearch()
 {
-    if (!bIsInLobby || LobbyMembers.Num() == 0)
+    QuickMatchRetryTimer.Invalidate();
+    if (QuickMatchState == EQuickMatchState::Searching && !QuickMatchSearch.IsValid() && !StartQuickMatchSearch())
     {
-        return false;
+        FinishQuickMatch(EQuickMatchResult::Failed, FString());
     }
+}
 
-    // Check if all members are ready
-    for (const TPair<FString, FLobbyMemberInfo>& Member : LobbyMembers)
+void UEOSLobbyManager::CancelQuickMatch()
+{
+    if (!IsQuickMatchRunning())
     {
-        if (!Member.Value.bIsReady)
-        {
-            EM_LOG_INFO(TEXT("Player %s is not ready"), *Member.Value.DisplayName);
-            return false;
-        }
+        return;
     }
 
-    EM_LOG_INFO(TEXT("All %d players are ready!"), LobbyMembers.Num());
-    if (GEngine) GEngine->AddOnScreenDebugMessage(-1,5.0f,FColor::Green,TEXT("All players in lobby are ready!"));
- 
-    return true;
+    // A join or create that was already sent still completes, its OnLobbyJoined / OnLobbyCreated fire as usual
+    ReleaseLobbySearch(QuickMatchSearch);
+    FinishQuickMatch(EQuickMatchResult::Cancelled, FString());
 }
 
-int32 UEOSLobbyManager::GetReadyPlayerCount() const
+void UEOSLobbyManager::HandleQuickMatchSearchFound(EOS_EResult Result, TWeakPtr<FLobbySearch> WeakSearch)
 {
-    int32 ReadyCount = 0;
+    TSharedPtr<FLobbySearch> Search = WeakSearch.Pin();
+    if (!Search.IsValid() || Search != QuickMatchSearch)
+    {
+        return;
+    }
+
+    if (Result == EOS_EResult::EOS_Canceled)
+    {
+        QuickMatchSearch.Reset();
+        FinishQuickMatch(EQuickMatchResult::Cancelled, FString());
+        return;
+    }
+
+    if (Result != EOS_EResult::EOS_Success)
+    {
+        EM_LOG_ERROR(TEXT("Quick match search failed: %s"), UTF8_TO_TCHAR(EOS_EResult_ToString(Result)));
+        FinishQuickMatch(EQuickMatchResult::Failed, FString());
+        return;
+    }
 
-    for (const TPair<FString, FLobbyMemberInfo>& Member : LobbyMembers)
+    FLobbyScorer Scorer = QuickMatchScorer ? QuickMatchScorer
+        : LobbyQuickMatch::MakeDefaultScorer(QuickMatchSettings.PreferredAttributes, QuickMatchSettings.AttributeWeight);
+    if (QuickMatchSettings.bMatchBySkill)
     {
-        if (Member.Value.bIsReady)
+        // Closer rating on top of the normal score, lobbies outside the window are out
+        Scorer = [BaseScorer = MoveTemp(Scorer), Rating = QuickMatchSettings.Rating, Window = QuickMatchSkillWindow](const FLobbyInfo& Lobby, EOS_HLobbyDetails LobbyDetails)
         {
-            ReadyCount++;
-        }
+            const float SkillScore = LobbyQuickMatch::ScoreSkill(LobbyDetails, Rating, Window);
+            return SkillScore < 0.0f ? SkillScore : BaseScorer(Lobby, LobbyDetails) + SkillScore;
+        };
+    }
+    if (QuickMatchLatencyCap > 0)
+    {
+        // Same for latency, the backend already dropped the regions over the cap
+        Scorer = [BaseScorer = MoveTemp(Scorer), Latencies = GetRegionLatencies(), Cap = QuickMatchLatencyCap, Weight = QuickMatchSettings.LatencyWeight](const FLobbyInfo& Lobby, EOS_HLobbyDetails LobbyDetails)
+        {
+            const float LatencyScore = LobbyQuickMatch::ScoreLatency(RegionLatency::Find(Latencies, Lobby.Region), Cap);
+            return LatencyScore < 0.0f ? LatencyScore : BaseScorer(Lobby, LobbyDetails) + LatencyScore * Weight;
+        };
     }
+    QuickMatchCandidates = LobbyQuickMatch::RankCandidates(*Search, Scorer);
+    ReleaseLobbySearch(QuickMatchSearch);
 
-    return ReadyCount;
+    EM_LOG_INFO(TEXT("Quick match found %d candidate lobbies"), QuickMatchCandidates.Num());
+    TryNextQuickMatchCandidate();
 }
 
-void UEOSLobbyManager::SetPlayerReady(bool bReady)
+void UEOSLobbyManager::TryNextQuickMatchCandidate()
 {
-    if (!bIsInLobby || CurrentLobbyId.IsEmpty() || !LobbyHandle || !LocalUserId)
+    if (QuickMatchCandidates.Num() > 0 && QuickMatchJoinAttempts < QuickMatchSettings.MaxJoinAttempts)
     {
-        EM_LOG_ERROR(TEXT("Cannot set ready status - not in lobby"));
+        const FQuickMatchCandidate Candidate = QuickMatchCandidates[0];
+        QuickMatchCandidates.RemoveAt(0);
+        QuickMatchJoinAttempts++;
+        QuickMatchState = EQuickMatchState::Joining;
+
+        EM_LOG_INFO(TEXT("Quick match joining %s (score %.2f, players %d/%d)"),
+            *Candidate.Lobby.LobbyId, Candidate.Score, Candidate.Lobby.CurrentPlayers, Candidate.Lobby.MaxPlayers);
+        JoinLobbyWithDetails(Candidate.LobbyDetails);
+        EOS_LobbyDetails_Release(Candidate.LobbyDetails);
         return;
     }
 
-    EOS_Lobby_UpdateLobbyModificationOptions ModifyOptions = {};
-    ModifyOptions.ApiVersion = EOS_LOBBY_UPDATELOBBYMODIFICATION_API_LATEST;
-    ModifyOptions.LocalUserId = LocalUserId;
+    LobbyQuickMatch::ReleaseCandidates(QuickMatchCandidates);
 
-    FTCHARToUTF8 LobbyIdConverter(*CurrentLobbyId);
-    ModifyOptions.LobbyId = LobbyIdConverter.Get();
+    // Nothing close enough yet, look again with a wider window. Not once the join attempts are used up,
+    // a wider search would only find lobbies we may not try anymore.
+    UWorld* World = GEngine->GetWorldFromContextObject(this, EGetWorldErrorMode::ReturnNull);
+    const UEasyMatchmakingSettings* Settings = UEasyMatchmakingSettings::Get();
+    const bool bAttemptsLeft = QuickMatchJoinAttempts < QuickMatchSettings.MaxJoinAttempts;
+    const bool bSkillCanWiden = QuickMatchSettings.bMatchBySkill && QuickMatchSkillWindow < QuickMatchSettings.MaxSkillWindow
+        && QuickMatchSettings.SkillRetryInterval > 0.0f;
+    const bool bLatencyCanWiden = QuickMatchLatencyCap > 0 && QuickMatchLatencyCap < Settings->MaxWidenedLatencyMs
+        && QuickMatchSettings.LatencyRetryInterval > 0.0f;
 
-    EOS_HLobbyModification LobbyModificationHandle = nullptr;
-    EOS_EResult ModifyResult = EOS_Lobby_UpdateLobbyModification(LobbyHandle, &ModifyOptions, &LobbyModificationHandle);
+    float RetryInterval = 0.0f;
+    if (bSkillCanWiden && bLatencyCanWiden)
+    {
+        RetryInterval = FMath::Min(QuickMatchSettings.SkillRetryInterval, QuickMatchSettings.LatencyRetryInterval);
+    }
+    else if (bSkillCanWiden || bLatencyCanWiden)
+    {
+        RetryInterval = bSkillCanWiden ? QuickMatchSettings.SkillRetryInterval : QuickMatchSettings.LatencyRetryInterval;
+    }
+
+    if (!bAttemptsLeft)
+    {
+        EM_LOG_INFO(TEXT("Quick match used all %d join attempts"), QuickMatchSettings.MaxJoinAttempts);
+    }
+    else if (RetryInterval > 0.0f && World)
+    {
+        EM_LOG_INFO(TEXT("Quick match found no lobby within %.0f rating / %d ms, widening"), QuickMatchSkillWindow, QuickMatchLatencyCap);
+        QuickMatchState = EQuickMatchState::Searching;
+        World->GetTimerManager().SetTimer(QuickMatchRetryTimer, this, &UEOSLobbyManager::RetryQuickMatchSearch, RetryInterval, false);
+        return;
+    }
+
+    if (!QuickMatchSettings.bCreateIfNoneFound)
+    {
+        FinishQuickMatch(EQuickMatchResult::NoLobbyFound, FString());
+        return;
+    }
+
+    EM_LOG_INFO(TEXT("Quick match found no lobby to join, creating one"));
+    QuickMatchState = EQuickMatchState::Creating;
+    CreateLobby(QuickMatchSettings.CreateSettings);
+}
+
+void UEOSLobbyManager::FinishQuickMatch(EQuickMatchResult Result, const FString& LobbyId)
+{
+    if (UWorld* World = GEngine->GetWorldFromContextObject(this, EGetWorldErrorMode::ReturnNull))
+    {
+        World->GetTimerManager().ClearTimer(QuickMatchRetryTimer);
+    }
+    ReleaseLobbySearch(QuickMatchSearch);
+    LobbyQuickMatch::ReleaseCandidates(QuickMatchCandidates);
+    QuickMatchState = EQuickMatchState::Idle;
+
+    EM_LOG_INFO(TEXT("Quick match finished: %s %s"), *UEnum::GetValueAsString(Result), *LobbyId);
+    OnQuickMatchComplete.Broadcast(Result, LobbyId);
+}
+
+TSharedPtr<FLobbySearch> UEOSLobbyManager::AcquireLobbySearch(const FLobbySearchParams& Params)
+{
+    const FString Key = Params.MakeKey();
+    for (const TPair<int32, TSharedRef<FLobbySearch>>& Pair : PendingLobbySearches)
+    {
+        if (Pair.Value->GetKey() == Key && !Pair.Value->IsCancelled())
+        {
+            EM_LOG_INFO(TEXT("Sharing lobby search %d (%s)"), Pair.Key, *Key);
+            Pair.Value->AddListener();
+            return Pair.Value;
+        }
+    }
+
+    const UEasyMatchmakingSettings* Settings = UEasyMatchmakingSettings::Get();
+    const int32 RequestId = NextLobbySearchRequestId++;
+
+    TSharedRef<FLobbySearch> Search = MakeShared<FLobbySearch>(RequestId, Params);
+    if (!Search->Start(LobbyHandle, LocalUserId, EOSManager->GetCircuitBreaker(), Settings->LobbySearchPageSize, Settings->LobbySearchFrameBudgetMs))
+    {
+        return nullptr;
+    }
+
+    Search->AddListener();
+    PendingLobbySearches.Add(RequestId, Search);
+    Search->OnFound.AddWeakLambda(this, [this, RequestId](EOS_EResult)
+    {
+        PendingLobbySearches.Remove(RequestId);
+    });
+
+    return Search;
+}
 
-    if (ModifyResult == EOS_EResult::EOS_Success && LobbyModificationHandle)
+void UEOSLobbyManager::ReleaseLobbySearch(TSharedPtr<FLobbySearch>& Search)
+{
+    // Reset first, releasing can fire EOS_Canceled into code that looks at our pointer
+    TSharedPtr<FLobbySearch> Released = MoveTemp(Search);
+    Search.Reset();
+    if (Released.IsValid())
     {
-        // Set ready status as member attribute
-        EOS_Lobby_AttributeData ReadyAttribute = {};
-        ReadyAttribute.ApiVersion = EOS_LOBBY_ATTRIBUTEDATA_API_LATEST;
-        ReadyAttribute.Key = "ready";
-        ReadyAttribute.Value.AsBool = bReady ? EOS_TRUE : EOS_FALSE;
-        ReadyAttribute.ValueType = EOS_ELobbyAttributeType::EOS_AT_BOOLEAN;
+        Released->ReleaseListener();
+    }
+}
+
+bool UEOSLobbyManager::RequestMoreLobbies()
+{
+    return BrowserSearch.IsValid() && !bRevalidatingBrowserSearch && BrowserSearch->RequestNextPage();
+}
+
+bool UEOSLobbyManager::HasMoreLobbies() const
+{
+    return BrowserSearch.IsValid() && !bRevalidatingBrowserSearch && BrowserSearch->HasMorePages();
+}
+
+void UEOSLobbyManager::HandleLobbiesPage(const TArray<FLobbyInfo>& Page, int32 PageIndex, bool bHasMore)
+{
+    EM_LOG_INFO(TEXT("Lobby search page %d: %d lobbies%s"), PageIndex, Page.Num(), bHasMore ? TEXT(" (more available)") : TEXT(""));
 
-        EOS_LobbyModification_AddMemberAttributeOptions AddMemberAttrOptions = {};
-        AddMemberAttrOptions.ApiVersion = EOS_LOBBYMODIFICATION_ADDMEMBERATTRIBUTE_API_LATEST;
-        AddMemberAttrOptions.Attribute = &ReadyAttribute;
-        AddMemberAttrOptions.Visibility = EOS_ELobbyAttributeVisibility::EOS_LAT_PUBLIC;
+    CacheLobbyDetails(PageIndex);
 
-        EOS_EResult AddAttrResult = EOS_LobbyModification_AddMemberAttribute(LobbyModificationHandle, &AddMemberAttrOptions);
+    TArray<FLobbyInfo> Lobbies = Page;
+    ApplyRegionLatencies(Lobbies);
 
-        if (AddAttrResult == EOS_EResult::EOS_Success)
+    if (bRevalidatingBrowserSearch)
+    {
+        RevalidatedLobbies.Append(Lobbies);
+        if (bHasMore)
         {
-            // Apply the modification
-            EOS_Lobby_UpdateLobbyOptions UpdateOptions = {};
-            UpdateOptions.ApiVersion = EOS_LOBBY_UPDATELOBBY_API_LATEST;
-            UpdateOptions.LobbyModificationHandle = LobbyModificationHandle;
+            return;
+        }
 
-            EM_LOG_INFO(TEXT("Setting ready status to: %s"), bReady ? TEXT("Ready") : TEXT("Not Ready"));
-            EOS_Lobby_UpdateLobby(LobbyHandle, &UpdateOptions, this, OnUpdateReadyStatusLobbyComplete);
+        TArray<FLobbyInfo> ChangedLobbies;
+        TArray<FString> RemovedLobbyIds;
+        FLobbySearchCache::Diff(FoundLobbies, RevalidatedLobbies, ChangedLobbies, RemovedLobbyIds);
+        for (const FString& RemovedLobbyId : RemovedLobbyIds)
+        {
+            RemoveCachedLobbyDetails(RemovedLobbyId);
         }
-        else
+
+        FoundLobbies = MoveTemp(RevalidatedLobbies);
+        RevalidatedLobbies.Reset();
+        bRevalidatingBrowserSearch = false;
+        LobbySearchCache.Store(BrowserSearchKey, FoundLobbies, true);
+
+        EM_LOG_INFO(TEXT("Lobby search refreshed: %d changed, %d removed"), ChangedLobbies.Num(), RemovedLobbyIds.Num());
+        if (ChangedLobbies.Num() > 0 || RemovedLobbyIds.Num() > 0)
         {
-            EM_LOG_ERROR(TEXT("Failed to add member attribute: %s"),
-                UTF8_TO_TCHAR(EOS_EResult_ToString(AddAttrResult)));
+            OnLobbySearchResultsChanged.Broadcast(ChangedLobbies, RemovedLobbyIds);
+            OnLobbiesFound.Broadcast(FoundLobbies);
         }
+        return;
+    }
 
-        EOS_LobbyModification_Release(LobbyModificationHandle);
+    FoundLobbies.Append(Lobbies);
+    LobbySearchCache.Store(BrowserSearchKey, FoundLobbies, !bHasMore);
+
+    OnLobbiesPage.Broadcast(BrowserSearch.IsValid() ? BrowserSearch->GetRequestId() : INDEX_NONE, Lobbies, PageIndex, bHasMore);
+    OnLobbiesFound.Broadcast(FoundLobbies);
+}
+
+void UEOSLobbyManager::CacheLobbyDetails(int32 PageIndex)
+{
+    if (!BrowserSearch.IsValid())
+    {
+        return;
+    }
+
+    // Results line up with the search indexes, rows that failed to convert have no id
+    const TArray<FLobbyInfo>& Results = BrowserSearch->GetResults();
+    const int32 PageStart = PageIndex * BrowserSearch->GetPageSize();
+    const int32 PageEnd = FMath::Min(PageStart + BrowserSearch->GetPageSize(), Results.Num());
+
+    for (int32 Index = PageStart; Index < PageEnd; Index++)
+    {
+        const FString& LobbyId = Results[Index].LobbyId;
+        if (LobbyId.IsEmpty())
+        {
+            continue;
+        }
+
+        if (EOS_HLobbyDetails LobbyDetails = BrowserSearch->CopyResultDetails(Index))
+        {
+            // Newer handle replaces the one from the last search
+            RemoveCachedLobbyDetails(LobbyId);
+            CachedLobbyDetails.Add(LobbyId, LobbyDetails);
+        }
+    }
+}
+
+void UEOSLobbyManager::RemoveCachedLobbyDetails(const FString& LobbyId)
+{
+    EOS_HLobbyDetails LobbyDetails = nullptr;
+    if (CachedLobbyDetails.RemoveAndCopyValue(LobbyId, LobbyDetails) && LobbyDetails)
+    {
+        EOS_LobbyDetails_Release(LobbyDetails);
+    }
+}
+
+void UEOSLobbyManager::ReleaseCachedLobbyDetails()
+{
+    for (const TPair<FString, EOS_HLobbyDetails>& Pair : CachedLobbyDetails)
+    {
+        EOS_LobbyDetails_Release(Pair.Value);
+    }
+    CachedLobbyDetails.Empty();
+}
+
+const FLobbyInfo UEOSLobbyManager::UpdateLobbyInfoData()
+{
+    if (!bIsInLobby || CurrentLobbyId.IsEmpty())
+    {
+        EM_LOG_ERROR(TEXT("Not in a lobby to refresh"));
+        return FLobbyInfo();
+    }
+
+    // Served from the snapshot, only go to EOS when we don't have one yet
+    if (!LobbySnapshot.IsValid() && !RefreshLobbySnapshot())
+    {
+        EM_LOG_ERROR(TEXT("Failed to get lobby details to refresh lobby info"));
+        return FLobbyInfo();
+    }
+
+    const FLobbySnapshot& Snapshot = *LobbySnapshot;
+
+    EM_LOG_INFO(TEXT("Current lobby refreshed: %s (Players: %d/%d)"),
+        *CurrentLobbyId,
+        Snapshot.GetCurrentMemberCount(),
+        Snapshot.MaxMembers);
+
+    FLobbyInfo UpdatedInfo;
+    UpdatedInfo.LobbyId = CurrentLobbyId;
+    UpdatedInfo.CurrentPlayers = Snapshot.GetCurrentMemberCount();
+    UpdatedInfo.MaxPlayers = Snapshot.MaxMembers;
+    UpdatedInfo.BucketId = Snapshot.BucketId;
+
+    if (Snapshot.OwnerUserId)
+    {
+        UpdatedInfo.OwnerUserId = Snapshot.OwnerUserIdString.IsEmpty() ? TEXT("Unknown") : Snapshot.OwnerUserIdString;
     }
     else
     {
-        EM_LOG_ERROR(TEXT("Failed to create lobby modification: %s"),
-            UTF8_TO_TCHAR(EOS_EResult_ToString(ModifyResult)));
+        UpdatedInfo.OwnerUserId = TEXT("No Owner");
+    }
+
+    // Update current lobby settings
+    CurrentSettings.MaxPlayers = Snapshot.MaxMembers;
+    CurrentSettings.BucketId = Snapshot.BucketId;
+
+    FLobbySummary Summary;
+    const FLobbyAttributeValue& SummaryValue = Snapshot.GetAttribute(FLobbyAttributeSchema::SummarySlot);
+    if (SummaryValue.IsSet() && FLobbySummary::Decode(SummaryValue.StringValue, Summary))
+    {
+        Summary.ApplyTo(UpdatedInfo);
+        if (!Summary.LobbyName.IsEmpty())
+        {
+            CurrentSettings.LobbyName = Summary.LobbyName;
+        }
+        CurrentSettings.GameMode = Summary.GameMode;
+        CurrentSettings.MapName = Summary.MapName;
+        CurrentSettings.Region = Summary.Region;
+        CurrentSettings.BuildId = Summary.BuildId;
+        CurrentSettings.bIsPrivate = Summary.bIsPrivate;
+    }
+
+    // Check for session address attribute
+    const FLobbyAttributeValue& SessionAddress = Snapshot.GetAttribute(FLobbyAttributeSchema::SessionAddressSlot);
+    if (SessionAddress.IsSet())
+    {
+        EM_LOG_INFO(TEXT("Session address available: %s"), *SessionAddress.StringValue);
+
+        // Broadcast to all members
+        OnSessionAddressUpdated.Broadcast(SessionAddress.StringValue);
+    }
+
+    return UpdatedInfo;
+}
+
+void UEOSLobbyManager::RegisterP2PNotifications()
+{
+    EOS_HP2P P2PHandle = EOS_Platform_GetP2PInterface(PlatformHandle);
+    if (!P2PHandle)
+    {
+        EM_LOG_ERROR(TEXT("Failed to get P2P interface"));
+        return;
+    }
+
+    // Initialize chat socket ID
+    ChatSocketId = {};
+    ChatSocketId.ApiVersion = EOS_P2P_SOCKETID_API_LATEST;    
+    FCStringAnsi::Strncpy(ChatSocketId.SocketName, "CHAT", sizeof(ChatSocketId.SocketName) - 1); 
+
+    EM_LOG_INFO(TEXT("ChatSocketId initialized: Name=%s, ApiVersion=%d"),
+        UTF8_TO_TCHAR(ChatSocketId.SocketName),
+        ChatSocketId.ApiVersion);
+
+    EOS_P2P_AddNotifyPeerConnectionRequestOptions RequestOptions = {};
+    RequestOptions.ApiVersion = EOS_P2P_ADDNOTIFYPEERCONNECTIONREQUEST_API_LATEST;
+    RequestOptions.LocalUserId = LocalUserId;
+    RequestOptions.SocketId = &ChatSocketId;
+
+    P2PConnectionRequestNotificationId = EOS_P2P_AddNotifyPeerConnectionRequest(
+        P2PHandle,
+        &RequestOptions,
+        this,
+        OnIncomingConnectionRequest
+    );
+
+    if (P2PConnectionRequestNotificationId != EOS_INVALID_NOTIFICATIONID)
+    {
+        EM_LOG_INFO(TEXT("Registered P2P connection notifications (ID: %llu)"), P2PConnectionRequestNotificationId);
+    }
+    else
+    {
+        EM_LOG_ERROR(TEXT("Failed to register P2P notifications!"));
+    }
+}
+
+void UEOSLobbyManager::RegisterTimerForTickP2PMessages(UEOSLobbyManager* LobbyManager)
+{
+    if (UWorld* World = GEngine->GetWorldFromContextObject(LobbyManager, EGetWorldErrorMode::LogAndReturnNull))
+    {
+        World->GetTimerManager().SetTimer(
+            LobbyManager->ChatTickTimer,
+            LobbyManager,
+            &UEOSLobbyManager::TickP2PMessages,
+            0.1f,
+            true
+        );
+    }
+}
+
+void UEOSLobbyManager::UnregisterTimerForTickP2PMessages(UEOSLobbyManager* LobbyManager)
+{
+    if (UWorld* World = GEngine->GetWorldFromContextObject(LobbyManager, EGetWorldErrorMode::LogAndReturnNull))
+    {
+        World->GetTimerManager().ClearTimer(LobbyManager->ChatTickTimer);
+    }
+}
+
+bool UEOSLobbyManager::IsLobbyOwner() const
+{
+    // Widgets call this every frame, so it only reads the snapshot
+    if (!bIsInLobby || !LobbySnapshot.IsValid() || !LocalUserId)
+    {
+        return false;
+    }
+
+    return LobbySnapshot->OwnerUserId == LocalUserId;
+}
+
+void UEOSLobbyManager::SetPlayerReady(bool bReady)
+{
+    if (!bIsInLobby || CurrentLobbyId.IsEmpty() || !LobbyHandle || !LocalUserId)
+    {
+        EM_LOG_ERROR(TEXT("Cannot set ready status - not in lobby"));
+        return;
     }
+
+    EM_LOG_INFO(TEXT("Setting ready status to: %s"), bReady ? TEXT("Ready") : TEXT("Not Ready"));
+    QueueLobbyAttribute(ELobbyAttributeScope::Member, FLobbyAttributeSchema::ReadySlot, FLobbyAttributeValue::MakeBool(bReady),
+        [this](EOS_EResult Result) { HandleReadyStatusUpdated(Result); });
 }
 
 void UEOSLobbyManager::SetLobbySessionAddress(const FString& SessionAddress)
@@ -665,890 +1181,1613 @@ void UEOSLobbyManager::SetLobbySessionAddress(const FString& SessionAddress)
     }
 
     EM_LOG_INFO(TEXT("Setting lobby session address: %s"), *SessionAddress);
+    QueueLobbyAttribute(ELobbyAttributeScope::Lobby, FLobbyAttributeSchema::SessionAddressSlot, FLobbyAttributeValue::MakeString(SessionAddress),
+        [this](EOS_EResult Result) { HandleSessionAddressUpdated(Result); });
+}
 
-    EOS_Lobby_UpdateLobbyModificationOptions ModifyOptions = {};
-    ModifyOptions.ApiVersion = EOS_LOBBY_UPDATELOBBYMODIFICATION_API_LATEST;
-    ModifyOptions.LocalUserId = LocalUserId;
+void UEOSLobbyManager::SetLobbySessionServer(const FLobbySessionServer& Server)
+{
+    if (!bIsInLobby || CurrentLobbyId.IsEmpty() || !LobbyHandle || !LocalUserId)
+    {
+        EM_LOG_ERROR(TEXT("Cannot set session server - not in lobby"));
+        return;
+    }
+
+    EM_LOG_INFO(TEXT("Setting lobby session server: %s at %s"), *Server.SessionId, *Server.ServerAddress);
+    QueueLobbyAttribute(ELobbyAttributeScope::Lobby, FLobbyAttributeSchema::SessionServerSlot, FLobbyAttributeValue::MakeString(Server.Encode()), nullptr);
+}
+
+bool UEOSLobbyManager::GetLobbySessionServer(FLobbySessionServer& OutServer) const
+{
+    if (!bIsInLobby || !LobbySnapshot.IsValid())
+    {
+        return false;
+    }
+
+    const FString SessionAddress = LobbySnapshot->GetAttribute(FLobbyAttributeSchema::SessionAddressSlot).StringValue;
+    const FLobbyAttributeValue& Packed = LobbySnapshot->GetAttribute(FLobbyAttributeSchema::SessionServerSlot);
+
+    // A server left over from an earlier session is no good
+    return !SessionAddress.IsEmpty()
+        && Packed.Type == ELobbyAttributeType::String
+        && FLobbySessionServer::Decode(Packed.StringValue, OutServer)
+        && OutServer.SessionId == SessionAddress
+        && !OutServer.ServerAddress.IsEmpty();
+}
+
+void UEOSLobbyManager::DeclareLobbyAttribute(const FString& Key, ELobbyAttributeType Type)
+{
+    AttributeSchema.Declare(ELobbyAttributeScope::Lobby, Key, Type);
+
+    // Pick up the value right away if we are already in a lobby
+    if (bIsInLobby)
+    {
+        RefreshLobbySnapshot();
+    }
+}
+
+void UEOSLobbyManager::DeclareMemberAttribute(const FString& Key, ELobbyAttributeType Type)
+{
+    AttributeSchema.Declare(ELobbyAttributeScope::Member, Key, Type);
+
+    if (bIsInLobby)
+    {
+        RefreshLobbySnapshot();
+    }
+}
+
+FLobbyAttributeValue UEOSLobbyManager::GetLobbyAttribute(const FString& Key) const
+{
+    const int32 Slot = AttributeSchema.FindSlot(ELobbyAttributeScope::Lobby, Key);
+    if (Slot == INDEX_NONE || !LobbySnapshot.IsValid())
+    {
+        return FLobbyAttributeValue();
+    }
+
+    return LobbySnapshot->GetAttribute(Slot);
+}
+
+FLobbyAttributeValue UEOSLobbyManager::GetMemberAttribute(const FString& MemberId, const FString& Key) const
+{
+    const int32 Slot = AttributeSchema.FindSlot(ELobbyAttributeScope::Member, Key);
+    if (Slot == INDEX_NONE)
+    {
+        return FLobbyAttributeValue();
+    }
+
+    for (const FLobbyMemberInfo& Member : LobbyMembers)
+    {
+        if (Member.UserIdString == MemberId)
+        {
+            return GetMemberAttributeBySlot(Member.UserId, Slot);
+        }
+    }
+
+    return FLobbyAttributeValue();
+}
+
+const FLobbyAttributeValue& UEOSLobbyManager::GetMemberAttributeBySlot(EOS_ProductUserId UserId, int32 Slot) const
+{
+    const FLobbySnapshotMember* SnapshotMember = LobbySnapshot.IsValid() ? LobbySnapshot->FindMember(UserId) : nullptr;
+    static const FLobbyAttributeValue UnsetValue;
+    return SnapshotMember ? FLobbySnapshot::GetAttributeFrom(SnapshotMember->Attributes, Slot) : UnsetValue;
+}
+
+void UEOSLobbyManager::SetLobbyAttribute(ELobbyAttributeScope Scope, const FString& Key, const FLobbyAttributeValue& Value, FOnLobbyModificationComplete OnComplete)
+{
+    if (!bIsInLobby || CurrentLobbyId.IsEmpty() || !LobbyHandle || !LocalUserId)
+    {
+        EM_LOG_ERROR(TEXT("Cannot set lobby attribute %s - not in lobby"), *Key);
+        if (OnComplete)
+        {
+            OnComplete(EOS_EResult::EOS_NotFound);
+        }
+        return;
+    }
+
+    if (Scope == ELobbyAttributeScope::Lobby && !IsLobbyOwner())
+    {
+        EM_LOG_WARNING(TEXT("Only the lobby owner can set lobby attribute %s"), *Key);
+        if (OnComplete)
+        {
+            OnComplete(EOS_EResult::EOS_Lobby_NotOwner);
+        }
+        return;
+    }
+
+    // Writing a key declares it, so we also read it back from now on
+    const int32 Slot = AttributeSchema.Declare(Scope, Key, Value.Type);
+    QueueLobbyAttribute(Scope, Slot, Value,
+        [Key, OnComplete = MoveTemp(OnComplete)](EOS_EResult Result)
+        {
+            if (Result == EOS_EResult::EOS_Success)
+            {
+                EM_LOG_INFO(TEXT("Lobby attribute %s updated successfully"), *Key);
+            }
+            else
+            {
+                EM_LOG_ERROR(TEXT("Failed to update lobby attribute %s: %s"), *Key, UTF8_TO_TCHAR(EOS_EResult_ToString(Result)));
+            }
+
+            if (OnComplete)
+            {
+                OnComplete(Result);
+            }
+        });
+}
+
+void UEOSLobbyManager::QueueLobbyAttribute(ELobbyAttributeScope Scope, int32 Slot, const FLobbyAttributeValue& Value, FOnLobbyModificationComplete&& OnComplete)
+{
+    LobbyModifications.Enqueue(Scope, Slot, Value, MoveTemp(OnComplete));
+    ScheduleLobbyModificationFlush();
+}
+
+void UEOSLobbyManager::ScheduleLobbyModificationFlush()
+{
+    // An update in flight flushes the rest when it completes
+    if (!LobbyModifications.HasPending() || LobbyModifications.IsInFlight())
+    {
+        return;
+    }
+
+    UWorld* World = GEngine->GetWorldFromContextObject(this, EGetWorldErrorMode::ReturnNull);
+    if (!World)
+    {
+        FlushLobbyModifications();
+        return;
+    }
+
+    FTimerManager& TimerManager = World->GetTimerManager();
+    if (TimerManager.TimerExists(LobbyModificationFlushTimer))
+    {
+        return;
+    }
+
+    const float BatchWindow = UEasyMatchmakingSettings::Get()->LobbyUpdateBatchWindow;
+    if (BatchWindow > 0.0f)
+    {
+        TimerManager.SetTimer(LobbyModificationFlushTimer, this, &UEOSLobbyManager::FlushLobbyModifications, BatchWindow, false);
+    }
+    else
+    {
+        LobbyModificationFlushTimer = TimerManager.SetTimerForNextTick(this, &UEOSLobbyManager::FlushLobbyModifications);
+    }
+}
+
+void UEOSLobbyManager::FlushLobbyModificationsNow()
+{
+    if (UWorld* World = GEngine->GetWorldFromContextObject(this, EGetWorldErrorMode::ReturnNull))
+    {
+        World->GetTimerManager().ClearTimer(LobbyModificationFlushTimer);
+    }
+    FlushLobbyModifications();
+}
+
+void UEOSLobbyManager::FlushLobbyModifications()
+{
+    LobbyModificationFlushTimer.Invalidate();
+
+    TArray<FLobbyModificationQueue::FWrite> Writes;
+    if (!LobbyModifications.BeginFlush(Writes))
+    {
+        return;
+    }
+
+    if (!bIsInLobby || CurrentLobbyId.IsEmpty() || !LobbyHandle || !LocalUserId)
+    {
+        EM_LOG_WARNING(TEXT("Dropping %d lobby attribute writes - not in lobby"), Writes.Num());
+        LobbyModifications.CompleteFlush(EOS_EResult::EOS_NotFound);
+        return;
+    }
+
+    EOS_Lobby_UpdateLobbyModificationOptions ModifyOptions = {};
+    ModifyOptions.ApiVersion = EOS_LOBBY_UPDATELOBBYMODIFICATION_API_LATEST;
+    ModifyOptions.LocalUserId = LocalUserId;
+
+    FTCHARToUTF8 LobbyIdConverter(*CurrentLobbyId);
+    ModifyOptions.LobbyId = LobbyIdConverter.Get();
+
+    EOS_HLobbyModification LobbyModificationHandle = nullptr;
+    EOS_EResult ModifyResult = EOS_Lobby_UpdateLobbyModification(LobbyHandle, &ModifyOptions, &LobbyModificationHandle);
+
+    if (ModifyResult != EOS_EResult::EOS_Success || !LobbyModificationHandle)
+    {
+        EM_LOG_ERROR(TEXT("Failed to create lobby modification: %s"),
+            UTF8_TO_TCHAR(EOS_EResult_ToString(ModifyResult)));
+        LobbyModifications.CompleteFlush(ModifyResult != EOS_EResult::EOS_Success ? ModifyResult : EOS_EResult::EOS_UnexpectedError);
+        ScheduleLobbyModificationFlush();
+        return;
+    }
+
+    EOS_EResult AddAttrResult = EOS_EResult::EOS_Success;
+    for (const FLobbyModificationQueue::FWrite& Write : Writes)
+    {
+        const FLobbyAttributeSchema::FKey* AttributeKey = AttributeSchema.GetKey(Write.Scope, Write.Slot);
+        if (!AttributeKey)
+        {
+            continue;
+        }
+
+        TArray<ANSICHAR> StringStorage;
+        EOS_Lobby_AttributeData AttributeData;
+        Write.Value.ToEOS(AttributeData, AttributeKey->Utf8Key.GetData(), StringStorage);
+
+        if (Write.Scope == ELobbyAttributeScope::Lobby)
+        {
+            EOS_LobbyModification_AddAttributeOptions AddAttrOptions = {};
+            AddAttrOptions.ApiVersion = EOS_LOBBYMODIFICATION_ADDATTRIBUTE_API_LATEST;
+            AddAttrOptions.Attribute = &AttributeData;
+            AddAttrOptions.Visibility = EOS_ELobbyAttributeVisibility::EOS_LAT_PUBLIC;
+
+            AddAttrResult = EOS_LobbyModification_AddAttribute(LobbyModificationHandle, &AddAttrOptions);
+        }
+        else
+        {
+            EOS_LobbyModification_AddMemberAttributeOptions AddMemberAttrOptions = {};
+            AddMemberAttrOptions.ApiVersion = EOS_LOBBYMODIFICATION_ADDMEMBERATTRIBUTE_API_LATEST;
+            AddMemberAttrOptions.Attribute = &AttributeData;
+            AddMemberAttrOptions.Visibility = EOS_ELobbyAttributeVisibility::EOS_LAT_PUBLIC;
+
+            AddAttrResult = EOS_LobbyModification_AddMemberAttribute(LobbyModificationHandle, &AddMemberAttrOptions);
+        }
+
+        if (AddAttrResult != EOS_EResult::EOS_Success)
+        {
+            EM_LOG_ERROR(TEXT("Failed to add lobby attribute %s: %s"),
+                *AttributeKey->Key,
+                UTF8_TO_TCHAR(EOS_EResult_ToString(AddAttrResult)));
+            break;
+        }
+    }
+
+    if (AddAttrResult == EOS_EResult::EOS_Success)
+    {
+        EM_LOG_INFO(TEXT("Sending %d lobby attribute writes in one update"), Writes.Num());
+
+        // Apply the modification, the handle stays alive until it is answered so a retry can send it again
+        TSharedRef<TEOSHandleGuard<EOS_HLobbyModification>> Modification =
+            MakeShared<TEOSHandleGuard<EOS_HLobbyModification>>(LobbyModificationHandle, &EOS_LobbyModification_Release);
+        EOSOperationRunner::Run(EOSOperations::UpdateLobby, EOSManager->GetCircuitBreaker(), this, this,
+            [this, Modification](void* OperationData, EOS_Lobby_OnUpdateLobbyCallback Callback)
+            {
+                EOS_Lobby_UpdateLobbyOptions UpdateOptions = {};
+                UpdateOptions.ApiVersion = EOS_LOBBY_UPDATELOBBY_API_LATEST;
+                UpdateOptions.LobbyModificationHandle = Modification->Handle;
+
+                EOS_Lobby_UpdateLobby(LobbyHandle, &UpdateOptions, OperationData, Callback);
+                return true;
+            },
+            OnLobbyModificationComplete);
+    }
+    else
+    {
+        EOS_LobbyModification_Release(LobbyModificationHandle);
+        LobbyModifications.CompleteFlush(AddAttrResult);
+        ScheduleLobbyModificationFlush();
+    }
+}
+
+// ---------------------------------------------------------------
+// Static callback functions implementations
+// ---------------------------------------------------------------
+
+void UEOSLobbyManager::OnLobbyUpdateReceived(const EOS_Lobby_LobbyUpdateReceivedCallbackInfo* Data)
+{
+    UEOSLobbyManager* LobbyManager = static_cast<UEOSLobbyManager*>(Data->ClientData);
+    if (!IsValid(LobbyManager))
+    {
+        return;
+    }
+
+    FString LobbyId = UTF8_TO_TCHAR(Data->LobbyId);
+    EM_LOG_INFO(TEXT("Lobby Update Received for: %s"), *LobbyId);
+
+    // Check if it's our current lobby
+    if (LobbyId == LobbyManager->CurrentLobbyId)
+    {
+        // Read the lobby once, everything below is served from the snapshot
+        LobbyManager->RefreshLobbySnapshot();
+
+        // Check for session address update
+        FString SessionAddress = LobbyManager->GetLobbySessionAddress();
+
+        if (!SessionAddress.IsEmpty() && SessionAddress != LobbyManager->LastKnownSessionAddress)
+        {
+            EM_LOG_INFO(TEXT("Session address updated: %s"), *SessionAddress);
+            LobbyManager->LastKnownSessionAddress = SessionAddress;
+
+            // Broadcast to Blueprint!
+            LobbyManager->OnSessionAddressUpdated.Broadcast(SessionAddress);
+
+            if (LobbyManager->EOSManager)
+            {
+                if (UEOSSessionManager* SessionManager = LobbyManager->EOSManager->GetSessionManager())
+                {
+                    if (LobbyManager->IsLobbyOwner())
+                    {
+                        EM_LOG_INFO(TEXT("Already in this session (we're the owner) - skipping auto-join. Owners can start the game only and they should be already joining the session"));
+                    }
+                    else
+                    {
+                        // Members join one slot after another, simultaneous joins (especially several clients on one PC) collide
+                        LobbyManager->ScheduleSessionJoin(SessionAddress);
+                    }
+                }
+                else
+                {
+                    EM_LOG_ERROR(TEXT("SessionManager not available!"));
+                }
+            }
+        }
+
+        // Refresh lobby info
+        LobbyManager->UpdateLobbyInfoData();
+    }
+    else
+    {
+        EM_LOG_ERROR(TEXT("Wrong lobby ID: %s, should be %s"), *LobbyId, *LobbyManager->CurrentLobbyId);
+    }
+}
+
+void UEOSLobbyManager::OnLobbyMemberUpdateReceived(const EOS_Lobby_LobbyMemberUpdateReceivedCallbackInfo* Data)
+{
+    UEOSLobbyManager* LobbyManager = static_cast<UEOSLobbyManager*>(Data->ClientData);
+    if (!IsValid(LobbyManager))
+    {
+        return;
+    }
+
+    FString LobbyId = UTF8_TO_TCHAR(Data->LobbyId);
+    FString MemberId = LobbyManager->GetMemberIdString(Data->TargetUserId);
+
+    EM_LOG_INFO(TEXT("Member Update Received - Lobby: % s, Member : % s"), *LobbyId, *MemberId);
+
+    // Update only the member that changed
+    if (LobbyId == LobbyManager->CurrentLobbyId)
+    {
+        LobbyManager->RefreshLobbySnapshotMember(Data->TargetUserId);
+        if (LobbyManager->UpdateLobbyMember(Data->TargetUserId))
+        {
+            LobbyManager->OnLobbyMemberJoined.Broadcast(MemberId);
+        }
+
+        LobbyManager->OnLobbyMemberChanged.Broadcast(MemberId);
+        LobbyManager->OnLobbyMembersChanged.Broadcast();
+        LobbyManager->BroadcastReadyStateChanges();
+        LobbyManager->UpdateLobbyRating();
+        LobbyManager->CheckSessionHandoff();
+    }
+    else
+    {
+		EM_LOG_ERROR(TEXT("Wrong lobby ID: %s, should be %s"), *LobbyId, *LobbyManager->CurrentLobbyId);
+    }
+}
+
+void UEOSLobbyManager::OnLobbyMemberStatusReceived(const EOS_Lobby_LobbyMemberStatusReceivedCallbackInfo* Data)
+{
+    UEOSLobbyManager* LobbyManager = static_cast<UEOSLobbyManager*>(Data->ClientData);
+    if (!IsValid(LobbyManager))
+    {
+        return;
+    }
+
+    FString LobbyId = UTF8_TO_TCHAR(Data->LobbyId);
+    FString MemberId = LobbyManager->GetMemberIdString(Data->TargetUserId);
+
+    const char* StatusStr = "";
+    switch (Data->CurrentStatus)
+    {
+    case EOS_ELobbyMemberStatus::EOS_LMS_JOINED:
+        StatusStr = "JOINED";
+        break;
+    case EOS_ELobbyMemberStatus::EOS_LMS_LEFT:
+        StatusStr = "LEFT";
+        break;
+    case EOS_ELobbyMemberStatus::EOS_LMS_DISCONNECTED:
+        StatusStr = "DISCONNECTED";
+        break;
+    case EOS_ELobbyMemberStatus::EOS_LMS_KICKED:
+        StatusStr = "KICKED";
+        break;
+    case EOS_ELobbyMemberStatus::EOS_LMS_PROMOTED:
+        StatusStr = "PROMOTED";
+        break;
+    case EOS_ELobbyMemberStatus::EOS_LMS_CLOSED:
+        StatusStr = "CLOSED";
+        break;
+    }
+
+    EM_LOG_INFO(TEXT("Member Status - Lobby: %s, Member: %s, Status: %s"),
+        *LobbyId, *MemberId, UTF8_TO_TCHAR(StatusStr));
+
+    if (LobbyId != LobbyManager->CurrentLobbyId)
+    {
+        return;
+    }
+
+    const bool bIsLocalMember = (Data->TargetUserId == LobbyManager->LocalUserId);
+
+    switch (Data->CurrentStatus)
+    {
+    case EOS_ELobbyMemberStatus::EOS_LMS_JOINED:
+        LobbyManager->RefreshLobbySnapshotMember(Data->TargetUserId);
+        if (LobbyManager->UpdateLobbyMember(Data->TargetUserId))
+        {
+            LobbyManager->OnLobbyMemberJoined.Broadcast(MemberId);
+        }
+        break;
+
+    case EOS_ELobbyMemberStatus::EOS_LMS_LEFT:
+    case EOS_ELobbyMemberStatus::EOS_LMS_DISCONNECTED:
+    case EOS_ELobbyMemberStatus::EOS_LMS_KICKED:
+        if (bIsLocalMember && Data->CurrentStatus != EOS_ELobbyMemberStatus::EOS_LMS_LEFT)
+        {
+            // We are out of the lobby (our own LEFT is handled in OnLeaveLobbyComplete)
+            EM_LOG_WARNING(TEXT("Local user was removed from lobby %s (%s)"), *LobbyId, UTF8_TO_TCHAR(StatusStr));
+            LobbyManager->ClearLobbyState();
+            LobbyManager->OnLobbyLeft.Broadcast();
+
+            // Kicked means kicked, a disconnect is worth another try
+            if (Data->CurrentStatus == EOS_ELobbyMemberStatus::EOS_LMS_DISCONNECTED)
+            {
+                LobbyManager->StartLobbyRejoin(LobbyId);
+            }
+            return;
+        }
+
+        LobbyManager->RemoveLobbySnapshotMember(Data->TargetUserId);
+        if (LobbyManager->RemoveLobbyMember(Data->TargetUserId))
+        {
+            LobbyManager->OnLobbyMemberLeft.Broadcast(MemberId);
+        }
+        break;
+
+    case EOS_ELobbyMemberStatus::EOS_LMS_PROMOTED:
+        LobbyManager->HandleOwnerPromoted(Data->TargetUserId);
+        break;
+
+    case EOS_ELobbyMemberStatus::EOS_LMS_CLOSED:
+        EM_LOG_WARNING(TEXT("Lobby %s was closed"), *LobbyId);
+        LobbyManager->ClearLobbyState();
+        LobbyManager->OnLobbyLeft.Broadcast();
+        return;
+    }
+
+    LobbyManager->OnLobbyMembersChanged.Broadcast();
+
+    // Someone joining or leaving can start or break "everyone ready", and moves the lobby rating
+    LobbyManager->BroadcastReadyStateChanges();
+    LobbyManager->UpdateLobbyRating();
+    // The last member missing from the session may have just left
+    LobbyManager->CheckSessionHandoff();
+}
+
+void UEOSLobbyManager::OnCreateLobbyComplete(const EOS_Lobby_CreateLobbyCallbackInfo* Data)
+{
+    UEOSLobbyManager* LobbyManager = static_cast<UEOSLobbyManager*>(Data->ClientData);
+    if (!IsValid(LobbyManager))
+    {
+        return; // Don't access destroyed object
+    }
+
+    if (Data->ResultCode == EOS_EResult::EOS_Success)
+    {
+        LobbyManager->bIsInLobby = true;
+        LobbyManager->CurrentLobbyId = FString(UTF8_TO_TCHAR(Data->LobbyId));
+        LobbyManager->RefreshLobbySnapshot();
+
+        LobbyManager->RegisterTimerForTickP2PMessages(LobbyManager);
+        LobbyManager->RegisterLobbyNotifications();
+
+        EM_LOG_INFO(TEXT("Lobby created successfully! Lobby ID: %s"), *LobbyManager->CurrentLobbyId);
+
+        // OnLobbyCreated waits for the attributes, see FinishLobbyCreation
+        LobbyManager->PublishInitialLobbyState();
+        return;
+    }
+
+    EM_LOG_ERROR(TEXT("Failed to create lobby. Error: %s"),
+        UTF8_TO_TCHAR(EOS_EResult_ToString(Data->ResultCode)));
+
+    FString ErrorMsg = FString(UTF8_TO_TCHAR(EOS_EResult_ToString(Data->ResultCode)));
+    LobbyManager->OnLobbyError.Broadcast(ErrorMsg);
+
+    const int32 RequestId = LobbyManager->CreateRequestId;
+    LobbyManager->CreateRequestId = 0;
+    LobbyManager->OnLobbyOperationComplete.Broadcast(ELobbyOperation::Create, Data->ResultCode, FString(), RequestId);
+
+    if (LobbyManager->QuickMatchState == EQuickMatchState::Creating)
+    {
+        LobbyManager->FinishQuickMatch(EQuickMatchResult::Failed, FString());
+    }
+}
+
+void UEOSLobbyManager::PublishInitialLobbyState()
+{
+    for (const TPair<FString, FLobbyAttributeValue>& Attribute : CurrentSettings.InitialAttributes)
+    {
+        if (IsReservedLobbyKey(Attribute.Key))
+        {
+            EM_LOG_WARNING(TEXT("Initial lobby attribute %s is reserved, skipped"), *Attribute.Key);
+            continue;
+        }
+        SetLobbyAttribute(ELobbyAttributeScope::Lobby, Attribute.Key, Attribute.Value);
+    }
+
+    PublishPlayerRating();
+
+    // Everything above is still pending, the whole set completes together
+    TWeakObjectPtr<UEOSLobbyManager> WeakThis(this);
+    PublishLobbySummary([WeakThis](EOS_EResult Result)
+    {
+        if (UEOSLobbyManager* LobbyManager = WeakThis.Get())
+        {
+            LobbyManager->FinishLobbyCreation(Result);
+        }
+    });
+
+    // No reason to wait for the batch window, nothing else can be queued for a lobby nobody knows about yet
+    FlushLobbyModificationsNow();
+}
+
+void UEOSLobbyManager::FinishLobbyCreation(EOS_EResult AttributesResult)
+{
+    const int32 RequestId = CreateRequestId;
+    CreateRequestId = 0;
+
+    if (!bIsInLobby)
+    {
+        // Left or lost the lobby while the attributes were in flight
+        OnLobbyOperationComplete.Broadcast(ELobbyOperation::Create, EOS_EResult::EOS_Canceled, FString(), RequestId);
+        if (QuickMatchState == EQuickMatchState::Creating)
+        {
+            FinishQuickMatch(EQuickMatchResult::Failed, FString());
+        }
+        return;
+    }
+
+    if (AttributesResult != EOS_EResult::EOS_Success)
+    {
+        // The lobby exists and is joinable, it just can't be found by its attributes yet
+        EM_LOG_ERROR(TEXT("Lobby %s created but its initial attributes failed: %s"),
+            *CurrentLobbyId, UTF8_TO_TCHAR(EOS_EResult_ToString(AttributesResult)));
+    }
+
+    OnLobbyCreated.Broadcast(CurrentLobbyId);
+    OnLobbyOperationComplete.Broadcast(ELobbyOperation::Create, EOS_EResult::EOS_Success, CurrentLobbyId, RequestId);
+
+    if (QuickMatchState == EQuickMatchState::Creating)
+    {
+        FinishQuickMatch(EQuickMatchResult::Created, CurrentLobbyId);
+    }
+}
+
+void UEOSLobbyManager::OnJoinLobbyComplete(const EOS_Lobby_JoinLobbyCallbackInfo* Data)
+{
+    UEOSLobbyManager* LobbyManager = static_cast<UEOSLobbyManager*>(Data->ClientData);
+    if (!IsValid(LobbyManager))
+    {
+        return; // Don't access destroyed object
+    }
+
+    LobbyManager->HandleJoinLobbyComplete(Data->ResultCode, Data->LobbyId);
+}
+
+#if defined(EOS_LOBBY_JOINLOBBYBYID_API_LATEST)
+void UEOSLobbyManager::OnJoinLobbyByIdComplete(const EOS_Lobby_JoinLobbyByIdCallbackInfo* Data)
+{
+    UEOSLobbyManager* LobbyManager = static_cast<UEOSLobbyManager*>(Data->ClientData);
+    if (!IsValid(LobbyManager))
+    {
+        return; // Don't access destroyed object
+    }
+
+    LobbyManager->HandleJoinLobbyComplete(Data->ResultCode, Data->LobbyId);
+}
+#endif
+
+void UEOSLobbyManager::HandleJoinLobbyComplete(EOS_EResult Result, const char* LobbyId)
+{
+    if (Result == EOS_EResult::EOS_Success)
+    {
+        bIsInLobby = true;
+
+        // Start P2P message polling
+        RegisterTimerForTickP2PMessages(this);
+        RegisterLobbyNotifications();
+
+        CurrentLobbyId = FString(UTF8_TO_TCHAR(LobbyId));
+        RefreshLobbySnapshot();
+        PublishPlayerRating();
+        OnLobbyJoined.Broadcast(CurrentLobbyId);
+
+        if (IsRejoiningLobby() && CurrentLobbyId == RejoinLobbyId)
+        {
+            FinishLobbyRejoin(true);
+        }
+
+        EM_LOG_INFO(TEXT("Successfully joined lobby: %s"), *CurrentLobbyId);
+    }
+    else
+    {
+        EM_LOG_ERROR(TEXT("Failed to join lobby. Error: %s"),
+            UTF8_TO_TCHAR(EOS_EResult_ToString(Result)));
+
+        // The cached handle might be stale (lobby closed or full), look it up again next time
+        if (LobbyId)
+        {
+            RemoveCachedLobbyDetails(FString(UTF8_TO_TCHAR(LobbyId)));
+        }
+
+        if (IsRejoiningLobby() && (!LobbyId || RejoinLobbyId == UTF8_TO_TCHAR(LobbyId)))
+        {
+            HandleLobbyRejoinFailed(Result);
+        }
+    }
+
+    OnLobbyOperationComplete.Broadcast(ELobbyOperation::Join, Result, LobbyId ? FString(UTF8_TO_TCHAR(LobbyId)) : FString(), 0);
+
+    if (QuickMatchState == EQuickMatchState::Joining)
+    {
+        if (Result == EOS_EResult::EOS_Success)
+        {
+            FinishQuickMatch(EQuickMatchResult::Joined, CurrentLobbyId);
+        }
+        else if (Result == EOS_EResult::EOS_Lobby_TooManyPlayers || Result == EOS_EResult::EOS_NotFound)
+        {
+            // Filled up or closed since the search, someone else got there first
+            TryNextQuickMatchCandidate();
+        }
+        else
+        {
+            FinishQuickMatch(EQuickMatchResult::Failed, FString());
+        }
+    }
+}
+
+void UEOSLobbyManager::OnLeaveLobbyComplete(const EOS_Lobby_LeaveLobbyCallbackInfo* Data)
+{
+    UEOSLobbyManager* LobbyManager = static_cast<UEOSLobbyManager*>(Data->ClientData);
+    if (!IsValid(LobbyManager))
+    {
+        return; // Don't access destroyed object
+    }
+
+    if (Data->ResultCode == EOS_EResult::EOS_Success)
+    {
+        
+        // Stop taking p2p requests and drop cached lobby data
+        LobbyManager->ClearLobbyState();
+        
+		LobbyManager->OnLobbyLeft.Broadcast();
+
+        EM_LOG_INFO(TEXT("Successfully left lobby"));
+    }
+    else
+    {
+        EM_LOG_ERROR(TEXT("Failed to leave lobby. Error: %s"),
+            UTF8_TO_TCHAR(EOS_EResult_ToString(Data->ResultCode)));
+    }
+
+    const int32 RequestId = LobbyManager->LeaveRequestId;
+    LobbyManager->LeaveRequestId = 0;
+    LobbyManager->OnLobbyOperationComplete.Broadcast(ELobbyOperation::Leave, Data->ResultCode, UTF8_TO_TCHAR(Data->LobbyId ? Data->LobbyId : ""), RequestId);
+}
+
+void UEOSLobbyManager::OnDestroyLobbyComplete(const EOS_Lobby_DestroyLobbyCallbackInfo* Data)
+{
+    UEOSLobbyManager* LobbyManager = static_cast<UEOSLobbyManager*>(Data->ClientData);
+    if (!IsValid(LobbyManager))
+    {
+        return;
+    }
+
+    if (Data->ResultCode == EOS_EResult::EOS_Success)
+    {
+        LobbyManager->ClearLobbyState();
+
+        EM_LOG_INFO(TEXT("Successfully destroyed lobby"));
+    }
+    else
+    {
+        EM_LOG_ERROR(TEXT("Failed to destroy lobby. Error: %s"),
+            UTF8_TO_TCHAR(EOS_EResult_ToString(Data->ResultCode)));
+    }
+
+    const int32 RequestId = LobbyManager->DestroyRequestId;
+    LobbyManager->DestroyRequestId = 0;
+    LobbyManager->OnLobbyOperationComplete.Broadcast(ELobbyOperation::Destroy, Data->ResultCode, UTF8_TO_TCHAR(Data->LobbyId ? Data->LobbyId : ""), RequestId);
+}
+
+// Check if still in lobby, with EOS (not just by comparing bool)
+bool UEOSLobbyManager::CheckWithEOSIsInLobby()
+{
+    if (CurrentLobbyId.IsEmpty())
+    {
+        EM_LOG_INFO(TEXT("CheckingIsInLobby: CurrentLobbyId == null"));
+        return false;
+    }
+
+    // Try to get current lobby details to verify we are still a member.
+    // Only the handle is probed, the getters read the snapshot.
+    EOS_Lobby_CopyLobbyDetailsHandleOptions CopyOptions = {};
+    CopyOptions.ApiVersion = EOS_LOBBY_COPYLOBBYDETAILSHANDLE_API_LATEST;
+    CopyOptions.LocalUserId = LocalUserId;
+
+    FTCHARToUTF8 LobbyIdConverter(*CurrentLobbyId);
+    CopyOptions.LobbyId = LobbyIdConverter.Get();
+
+    EOS_HLobbyDetails LobbyDetails = nullptr;
+    EOS_EResult Result = EOS_Lobby_CopyLobbyDetailsHandle(LobbyHandle, &CopyOptions, &LobbyDetails);
+
+    if (Result == EOS_EResult::EOS_Success && LobbyDetails)
+    {
+        EOS_LobbyDetails_Release(LobbyDetails);
+        bIsInLobby = true;
+        return true; // Successfully got lobby details, so we're still in it
+    }
+
+    // Failed to get lobby details - we might have been kicked or lobby was destroyed.
+    // No rejoin from here, we can't tell why. A disconnect starts one from the member status notification.
+    EM_LOG_WARNING(TEXT("Lobby %s is gone: %s"), *CurrentLobbyId, UTF8_TO_TCHAR(EOS_EResult_ToString(Result)));
+    ClearLobbyState();
+    OnLobbyLeft.Broadcast();
+    return false;
+}
+
+bool UEOSLobbyManager::RefreshLobbySnapshot()
+{
+    if (CurrentLobbyId.IsEmpty() || !LobbyHandle || !LocalUserId)
+    {
+        ResetLobbySnapshot();
+        return false;
+    }
+
+    EOS_Lobby_CopyLobbyDetailsHandleOptions CopyOptions = {};
+    CopyOptions.ApiVersion = EOS_LOBBY_COPYLOBBYDETAILSHANDLE_API_LATEST;
+    CopyOptions.LocalUserId = LocalUserId;
+
+    FTCHARToUTF8 LobbyIdConverter(*CurrentLobbyId);
+    CopyOptions.LobbyId = LobbyIdConverter.Get();
+
+    EOS_HLobbyDetails LobbyDetails = nullptr;
+    EOS_EResult Result = EOS_Lobby_CopyLobbyDetailsHandle(LobbyHandle, &CopyOptions, &LobbyDetails);
+
+    if (Result != EOS_EResult::EOS_Success || !LobbyDetails)
+    {
+        EM_LOG_WARNING(TEXT("Failed to copy lobby details for snapshot: %s"),
+            UTF8_TO_TCHAR(EOS_EResult_ToString(Result)));
+        ResetLobbySnapshot();
+        return false;
+    }
+
+    TSharedPtr<const FLobbySnapshot> NewSnapshot = FLobbySnapshot::Build(LobbyDetails, ++LobbySnapshotVersion, AttributeSchema, LobbySnapshot.Get());
+    EOS_LobbyDetails_Release(LobbyDetails);
+
+    if (!NewSnapshot.IsValid())
+    {
+        ResetLobbySnapshot();
+        return false;
+    }
+
+    LobbySnapshot = NewSnapshot;
+    return true;
+}
+
+bool UEOSLobbyManager::RefreshLobbySnapshotMember(EOS_ProductUserId UserId)
+{
+    if (!LobbySnapshot.IsValid())
+    {
+        return RefreshLobbySnapshot();
+    }
+
+    if (CurrentLobbyId.IsEmpty() || !LobbyHandle || !LocalUserId || !UserId)
+    {
+        return false;
+    }
+
+    EOS_Lobby_CopyLobbyDetailsHandleOptions CopyOptions = {};
+    CopyOptions.ApiVersion = EOS_LOBBY_COPYLOBBYDETAILSHANDLE_API_LATEST;
+    CopyOptions.LocalUserId = LocalUserId;
+
+    FTCHARToUTF8 LobbyIdConverter(*CurrentLobbyId);
+    CopyOptions.LobbyId = LobbyIdConverter.Get();
+
+    EOS_HLobbyDetails LobbyDetails = nullptr;
+    EOS_EResult Result = EOS_Lobby_CopyLobbyDetailsHandle(LobbyHandle, &CopyOptions, &LobbyDetails);
+
+    if (Result != EOS_EResult::EOS_Success || !LobbyDetails)
+    {
+        EM_LOG_WARNING(TEXT("Failed to copy lobby details for member update: %s"),
+            UTF8_TO_TCHAR(EOS_EResult_ToString(Result)));
+        ResetLobbySnapshot();
+        return false;
+    }
+
+    TSharedPtr<const FLobbySnapshot> NewSnapshot = LobbySnapshot->WithMemberUpdated(LobbyDetails, UserId, ++LobbySnapshotVersion, AttributeSchema);
+    EOS_LobbyDetails_Release(LobbyDetails);
+
+    if (!NewSnapshot.IsValid())
+    {
+        return false;
+    }
+
+    LobbySnapshot = NewSnapshot;
+    return true;
+}
+
+void UEOSLobbyManager::RemoveLobbySnapshotMember(EOS_ProductUserId UserId)
+{
+    if (LobbySnapshot.IsValid())
+    {
+        LobbySnapshot = LobbySnapshot->WithMemberRemoved(UserId, ++LobbySnapshotVersion);
+    }
+}
+
+void UEOSLobbyManager::ResetLobbySnapshot()
+{
+    // Last chance to see what we had set, a rejoin puts it back
+    const FLobbySnapshotMember* LocalMember = LobbySnapshot.IsValid() ? LobbySnapshot->FindMember(LocalUserId) : nullptr;
+    if (LocalMember)
+    {
+        LastLocalMemberLobbyId = LobbySnapshot->LobbyId;
+        LastLocalMemberAttributes = LocalMember->Attributes;
+    }
+
+    LobbySnapshot.Reset();
+}
+
+bool UEOSLobbyManager::UpdateLobbyMember(EOS_ProductUserId UserId)
+{
+    const FLobbySnapshotMember* SnapshotMember = LobbySnapshot.IsValid() ? LobbySnapshot->FindMember(UserId) : nullptr;
+    if (!SnapshotMember)
+    {
+        return false;
+    }
 
-    FTCHARToUTF8 LobbyIdConverter(*CurrentLobbyId);
-    ModifyOptions.LobbyId = LobbyIdConverter.Get();
+    bool bIsNewMember = false;
+    FLobbyMemberInfo& MemberInfo = LobbyMembers.FindOrAdd(UserId, SnapshotMember->UserIdString, &bIsNewMember);
+    MemberInfo.bIsLobbyOwner = (UserId == LobbySnapshot->OwnerUserId);
+    LobbyMembers.SetReady(MemberInfo, SnapshotMember->bIsReady);
 
-    EOS_HLobbyModification LobbyModificationHandle = nullptr;
-    EOS_EResult ModifyResult = EOS_Lobby_UpdateLobbyModification(LobbyHandle, &ModifyOptions, &LobbyModificationHandle);
+    EM_LOG_INFO(TEXT("Member %s ready status: %s"),
+        *SnapshotMember->UserIdString,
+        MemberInfo.bIsReady ? TEXT("Ready") : TEXT("Not Ready"));
 
-    if (ModifyResult == EOS_EResult::EOS_Success && LobbyModificationHandle)
+    if (MemberInfo.DisplayName.IsEmpty())
     {
-        // Set session address as lobby attribute
-        FTCHARToUTF8 SessionAddressConverter(*SessionAddress);
+        RequestDisplayName(UserId);
+    }
+
+    return bIsNewMember;
+}
 
-        EOS_Lobby_AttributeData SessionAttribute = {};
-        SessionAttribute.ApiVersion = EOS_LOBBY_ATTRIBUTEDATA_API_LATEST;
-        SessionAttribute.Key = "session_address";
-        SessionAttribute.Value.AsUtf8 = SessionAddressConverter.Get();
-        SessionAttribute.ValueType = EOS_ELobbyAttributeType::EOS_AT_STRING;
+bool UEOSLobbyManager::RemoveLobbyMember(EOS_ProductUserId UserId)
+{
+    return LobbyMembers.Remove(UserId);
+}
 
-        EOS_LobbyModification_AddAttributeOptions AddAttrOptions = {};
-        AddAttrOptions.ApiVersion = EOS_LOBBYMODIFICATION_ADDATTRIBUTE_API_LATEST;
-        AddAttrOptions.Attribute = &SessionAttribute;
-        AddAttrOptions.Visibility = EOS_ELobbyAttributeVisibility::EOS_LAT_PUBLIC;
+void UEOSLobbyManager::BroadcastReadyStateChanges()
+{
+    const int32 ReadyCount = LobbyMembers.GetReadyCount();
+    const int32 MemberCount = LobbyMembers.Num();
+    const bool bAllReady = AreAllPlayersReady();
 
-        EOS_EResult AddAttrResult = EOS_LobbyModification_AddAttribute(LobbyModificationHandle, &AddAttrOptions);
+    if (ReadyCount != BroadcastReadyCount || MemberCount != BroadcastMemberCount)
+    {
+        BroadcastReadyCount = ReadyCount;
+        BroadcastMemberCount = MemberCount;
+        OnReadyPlayerCountChanged.Broadcast(ReadyCount, MemberCount);
+    }
 
-        if (AddAttrResult == EOS_EResult::EOS_Success)
+    if (bAllReady != bBroadcastAllReady)
+    {
+        bBroadcastAllReady = bAllReady;
+        if (bAllReady)
         {
-            // Apply the modification
-            EOS_Lobby_UpdateLobbyOptions UpdateOptions = {};
-            UpdateOptions.ApiVersion = EOS_LOBBY_UPDATELOBBY_API_LATEST;
-            UpdateOptions.LobbyModificationHandle = LobbyModificationHandle;
-
-            EM_LOG_INFO(TEXT("Updating lobby with session address"));
-            EOS_Lobby_UpdateLobby(LobbyHandle, &UpdateOptions, this, OnSetSessionAddressComplete);
+            EM_LOG_INFO(TEXT("All %d players are ready"), MemberCount);
+            OnAllPlayersReady.Broadcast();
         }
         else
         {
-            EM_LOG_ERROR(TEXT("Failed to add session address attribute: %s"),
-                UTF8_TO_TCHAR(EOS_EResult_ToString(AddAttrResult)));
+            OnAllPlayersReadyLost.Broadcast();
         }
-
-        EOS_LobbyModification_Release(LobbyModificationHandle);
-    }
-    else
-    {
-        EM_LOG_ERROR(TEXT("Failed to create lobby modification: %s"),
-            UTF8_TO_TCHAR(EOS_EResult_ToString(ModifyResult)));
     }
 }
 
-// ---------------------------------------------------------------
-// Static callback functions implementations
-// ---------------------------------------------------------------
-
-void UEOSLobbyManager::OnLobbyUpdateReceived(const EOS_Lobby_LobbyUpdateReceivedCallbackInfo* Data)
+void UEOSLobbyManager::ClearLobbyState()
 {
-    UEOSLobbyManager* LobbyManager = static_cast<UEOSLobbyManager*>(Data->ClientData);
-    if (!IsValid(LobbyManager))
-    {
-        return;
-    }
-
-    FString LobbyId = UTF8_TO_TCHAR(Data->LobbyId);
-    EM_LOG_INFO(TEXT("Lobby Update Received for: %s"), *LobbyId);
+    // Stop taking p2p requests
+    UnregisterTimerForTickP2PMessages(this);
+    UnregisterLobbyNotifications();
 
-    // Check if it's our current lobby
-    if (LobbyId == LobbyManager->CurrentLobbyId)
+    // Writes for this lobby that did not go out yet
+    if (UWorld* World = GEngine->GetWorldFromContextObject(this, EGetWorldErrorMode::ReturnNull))
     {
-        // Check for session address update
-        FString SessionAddress = LobbyManager->GetLobbySessionAddress();
-
-        if (!SessionAddress.IsEmpty() && SessionAddress != LobbyManager->LastKnownSessionAddress)
-        {
-            EM_LOG_INFO(TEXT("Session address updated: %s"), *SessionAddress);
-            LobbyManager->LastKnownSessionAddress = SessionAddress;
-
-            // Broadcast to Blueprint!
-            LobbyManager->OnSessionAddressUpdated.Broadcast(SessionAddress);
+        World->GetTimerManager().ClearTimer(LobbyModificationFlushTimer);
+    }
+    LobbyModifications.CancelPending(EOS_EResult::EOS_Canceled);
+    CancelSessionHandoff();
 
-            if (LobbyManager->EOSManager)
-            {
-                if (UEOSSessionManager* SessionManager = LobbyManager->EOSManager->GetSessionManager())
-                {
-                    if (LobbyManager->IsLobbyOwner())
-                    {
-                        EM_LOG_INFO(TEXT("Already in this session (we're the owner) - skipping auto-join. Owners can start the game only and they should be already joining the session"));
-                    }
-                    else
-                    {
-                        // Add timer for member to stagger connection
-						// This is strange, but that solves an issue when multiple clients try to join the session at the same time on one PC. (there is some kind of bug)
-                        if (UWorld* World = LobbyManager->GetWorld())
-                        {
-                            FTimerHandle MemberJoinTimer;
-                            float Delay = FMath::RandRange(0.5f, 2.0f); // Random (0.5;2.0) second delay
-
-                            World->GetTimerManager().SetTimer(
-                                MemberJoinTimer,
-                                [LobbyManager, SessionManager, SessionAddress, Delay]()
-                                {
-                                    if (IsValid(LobbyManager) && IsValid(SessionManager))
-                                    {
-                                        EM_LOG_INFO(TEXT("[MEMBER] Auto-joining after %.1fs delay..."), Delay);
-                                        SessionManager->JoinSessionById(SessionAddress);
-                                    }
-                                },
-                                Delay,
-                                false // no loop
-                            );
-
-                            EM_LOG_INFO(TEXT("[MEMBER] Will auto-join in %.1f seconds..."), Delay);
-                        }
-                    }
-                }
-                else
-                {
-                    EM_LOG_ERROR(TEXT("SessionManager not available!"));
-                }
-            }
-        }
+    bIsInLobby = false;
+    CurrentLobbyId.Empty();
+    LastKnownSessionAddress.Empty();
+    LobbyMembers.Reset();
+    ResetLobbySnapshot();
+
+    // Next lobby starts counting from scratch
+    BroadcastReadyCount = 0;
+    BroadcastMemberCount = 0;
+    bBroadcastAllReady = false;
+}
 
-        // Refresh lobby info
-        LobbyManager->UpdateLobbyInfoData();
-    }
-    else
+void UEOSLobbyManager::UpdateLobbyMembersData()
+{
+    if (!bIsInLobby || CurrentLobbyId.IsEmpty() || !LobbyHandle || !LocalUserId)
     {
-        EM_LOG_ERROR(TEXT("Wrong lobby ID: %s, should be %s"), *LobbyId, *LobbyManager->CurrentLobbyId);
+        EM_LOG_WARNING(TEXT("Not in a lobby or invalid handles"));
+        return;
     }
-}
 
-void UEOSLobbyManager::OnLobbyMemberUpdateReceived(const EOS_Lobby_LobbyMemberUpdateReceivedCallbackInfo* Data)
-{
-    UEOSLobbyManager* LobbyManager = static_cast<UEOSLobbyManager*>(Data->ClientData);
-    if (!IsValid(LobbyManager))
+    if (!LobbySnapshot.IsValid() && !RefreshLobbySnapshot())
     {
+        EM_LOG_ERROR(TEXT("Failed to get lobby details for member list"));
         return;
     }
 
-    FString LobbyId = UTF8_TO_TCHAR(Data->LobbyId);
-    FString MemberId = LobbyManager->UserIdToString(Data->TargetUserId);
+    const FLobbySnapshot& Snapshot = *LobbySnapshot;
+    EM_LOG_INFO(TEXT("Lobby has %d members"), Snapshot.Members.Num());
 
-    EM_LOG_INFO(TEXT("Member Update Received - Lobby: % s, Member : % s"), *LobbyId, *MemberId);
+    // Drop members who are no longer in the lobby, then add/update the rest (new members go to the end, join order is kept)
+    LobbyMembers.RemoveAll([&Snapshot](const FLobbyMemberInfo& Member) { return Snapshot.FindMember(Member.UserId) == nullptr; });
 
-    // Update member list
-    if (LobbyId == LobbyManager->CurrentLobbyId)
+    for (const FLobbySnapshotMember& Member : Snapshot.Members)
     {
-        LobbyManager->UpdateLobbyMembersData();
+        FLobbyMemberInfo& MemberInfo = LobbyMembers.FindOrAdd(Member.UserId, Member.UserIdString);
+        MemberInfo.bIsLobbyOwner = (Member.UserId == Snapshot.OwnerUserId);
+        LobbyMembers.SetReady(MemberInfo, Member.bIsReady);
+    }
 
-        LobbyManager->OnLobbyMembersChanged.Broadcast();
+    for (const FLobbyMemberInfo& MemberInfo : LobbyMembers)
+    {
+        UE_LOG(LogTemp, Log, TEXT("Member [%s]: DisplayName=%s, Owner=%s, Ready=%s"),
+            *MemberInfo.UserIdString,
+            *MemberInfo.DisplayName,
+            MemberInfo.bIsLobbyOwner ? TEXT("Yes") : TEXT("No"),
+            MemberInfo.bIsReady ? TEXT("Yes") : TEXT("No"));
 
-        // Check if everyone is ready
-        if (LobbyManager->AreAllPlayersReady())
+        if (MemberInfo.DisplayName.IsEmpty())
         {
-            EM_LOG_WARNING(TEXT("ALL PLAYERS READY!"));
-            LobbyManager->OnAllPlayersReady.Broadcast();
+            RequestDisplayName(MemberInfo.UserId);
         }
-
-    }
-    else
-    {
-		EM_LOG_ERROR(TEXT("Wrong lobby ID: %s, should be %s"), *LobbyId, *LobbyManager->CurrentLobbyId);
     }
+
+    BroadcastReadyStateChanges();
+    UpdateLobbyRating();
 }
 
-void UEOSLobbyManager::OnLobbyMemberStatusReceived(const EOS_Lobby_LobbyMemberStatusReceivedCallbackInfo* Data)
+void UEOSLobbyManager::RequestDisplayName(EOS_ProductUserId UserId)
 {
-    UEOSLobbyManager* LobbyManager = static_cast<UEOSLobbyManager*>(Data->ClientData);
-    if (!IsValid(LobbyManager))
+    // Known from earlier or from the disk cache, show it right away (Request below revalidates it once it is too old)
+    if (const FResolvedDisplayName* Known = DisplayNameResolver->Find(UserId))
     {
-        return;
+        ApplyDisplayName(*Known);
     }
 
-    FString LobbyId = UTF8_TO_TCHAR(Data->LobbyId);
-    FString MemberId = LobbyManager->UserIdToString(Data->TargetUserId);
-
-    const char* StatusStr = "";
-    switch (Data->CurrentStatus)
+    if (!DisplayNameResolver->Request(UserId))
     {
-    case EOS_ELobbyMemberStatus::EOS_LMS_JOINED:
-        StatusStr = "JOINED";
-        break;
-    case EOS_ELobbyMemberStatus::EOS_LMS_LEFT:
-        StatusStr = "LEFT";
-        break;
-    case EOS_ELobbyMemberStatus::EOS_LMS_DISCONNECTED:
-        StatusStr = "DISCONNECTED";
-        break;
-    case EOS_ELobbyMemberStatus::EOS_LMS_KICKED:
-        StatusStr = "KICKED";
-        break;
-    case EOS_ELobbyMemberStatus::EOS_LMS_PROMOTED:
-        StatusStr = "PROMOTED";
-        break;
-    case EOS_ELobbyMemberStatus::EOS_LMS_CLOSED:
-        StatusStr = "CLOSED";
-        break;
+        return;
     }
 
-    EM_LOG_INFO(TEXT("Member Status - Lobby: %s, Member: %s, Status: %s"),
-        *LobbyId, *MemberId, UTF8_TO_TCHAR(StatusStr));
-
-    // Update member list
-    if (LobbyId == LobbyManager->CurrentLobbyId)
+    // Everyone requested this frame goes out in one query
+    UWorld* World = GEngine->GetWorldFromContextObject(this, EGetWorldErrorMode::ReturnNull);
+    if (!World)
     {
-        LobbyManager->UpdateLobbyMembersData();
+        DisplayNameResolver->Flush();
+        return;
+    }
 
-        LobbyManager->OnLobbyMembersChanged.Broadcast();
+    FTimerManager& TimerManager = World->GetTimerManager();
+    if (!TimerManager.TimerExists(DisplayNameFlushTimer))
+    {
+        DisplayNameFlushTimer = TimerManager.SetTimerForNextTick(this, &UEOSLobbyManager::FlushDisplayNameRequests);
     }
 }
 
-void UEOSLobbyManager::OnCreateLobbyComplete(const EOS_Lobby_CreateLobbyCallbackInfo* Data)
+void UEOSLobbyManager::FlushDisplayNameRequests()
 {
-    UEOSLobbyManager* LobbyManager = static_cast<UEOSLobbyManager*>(Data->ClientData);
-    if (!IsValid(LobbyManager))
+    DisplayNameFlushTimer.Invalidate();
+    DisplayNameResolver->Flush();
+}
+
+bool UEOSLobbyManager::ApplyDisplayName(const FResolvedDisplayName& Name)
+{
+    if (Name.UserId == LocalUserId)
     {
-        return; // Don't access destroyed object
+        LocalPlayerDisplayName = Name.DisplayName;
     }
 
-    if (Data->ResultCode == EOS_EResult::EOS_Success)
+    FLobbyMemberInfo* MemberInfo = LobbyMembers.Find(Name.UserId);
+    if (!MemberInfo)
     {
-        LobbyManager->bIsInLobby = true;
-        LobbyManager->CurrentLobbyId = FString(UTF8_TO_TCHAR(Data->LobbyId));
-
-        LobbyManager->RegisterTimerForTickP2PMessages(LobbyManager);
-        LobbyManager->RegisterLobbyNotifications();
+        return false;
+    }
 
-        LobbyManager->OnLobbyCreated.Broadcast(LobbyManager->CurrentLobbyId);
+    MemberInfo->DisplayName = Name.DisplayName;
+    MemberInfo->EpicAccountId = Name.EpicAccountId;
+    MemberInfo->EpicAccountIdString = Name.EpicAccountIdString;
+    return true;
+}
 
-        LobbyManager->RegisterLobbyNotifications();
+void UEOSLobbyManager::HandleDisplayNamesResolved(const TArray<FResolvedDisplayName>& Names)
+{
+    TArray<FString> MemberIds;
+    MemberIds.Reserve(Names.Num());
 
-        EM_LOG_INFO(TEXT("Lobby created successfully! Lobby ID: %s"), *LobbyManager->CurrentLobbyId);
-    }
-    else
+    for (const FResolvedDisplayName& Name : Names)
     {
-        EM_LOG_ERROR(TEXT("Failed to create lobby. Error: %s"),
-            UTF8_TO_TCHAR(EOS_EResult_ToString(Data->ResultCode)));
+        if (ApplyDisplayName(Name))
+        {
+            MemberIds.Add(GetMemberIdString(Name.UserId));
+        }
+    }
 
-        FString ErrorMsg = FString(UTF8_TO_TCHAR(EOS_EResult_ToString(Data->ResultCode)));
-        LobbyManager->OnLobbyError.Broadcast(ErrorMsg);
+    if (MemberIds.Num() > 0)
+    {
+        EM_LOG_INFO(TEXT("Updated %d member display names"), MemberIds.Num());
+        OnLobbyMemberDisplayNamesResolved.Broadcast(MemberIds);
+        OnLobbyMemberEpicGameNicknameGot.Broadcast();
     }
 }
 
-void UEOSLobbyManager::OnJoinLobbyComplete(const EOS_Lobby_JoinLobbyCallbackInfo* Data)
+FString UEOSLobbyManager::GetLobbySessionAddress() const
 {
-    UEOSLobbyManager* LobbyManager = static_cast<UEOSLobbyManager*>(Data->ClientData);
-    if (!IsValid(LobbyManager))
+    if (!bIsInLobby || CurrentLobbyId.IsEmpty() || !LobbyHandle || !LocalUserId)
     {
-        return; // Don't access destroyed object
+        EM_LOG_ERROR(TEXT("Cannot get session address - not in lobby"));
+        return FString();
     }
 
-    if (Data->ResultCode == EOS_EResult::EOS_Success)
+    if (!LobbySnapshot.IsValid())
     {
-        LobbyManager->bIsInLobby = true;
+        return FString();
+    }
 
-        // Start P2P message polling
-		LobbyManager->RegisterTimerForTickP2PMessages(LobbyManager);
-        LobbyManager->RegisterLobbyNotifications();
+    return LobbySnapshot->GetAttribute(FLobbyAttributeSchema::SessionAddressSlot).StringValue;
+}
 
-        LobbyManager->CurrentLobbyId = FString(UTF8_TO_TCHAR(Data->LobbyId));
-        LobbyManager->OnLobbyJoined.Broadcast(LobbyManager->CurrentLobbyId);
+void UEOSLobbyManager::OnLobbyModificationComplete(const EOS_Lobby_UpdateLobbyCallbackInfo* Data)
+{
+    UEOSLobbyManager* LobbyManager = static_cast<UEOSLobbyManager*>(Data->ClientData);
+    if (!IsValid(LobbyManager)) return;
 
+    LobbyManager->LobbyModifications.CompleteFlush(Data->ResultCode);
 
-        EM_LOG_INFO(TEXT("Successfully joined lobby: %s"), *LobbyManager->CurrentLobbyId);
-    }
-    else
-    {
-        EM_LOG_ERROR(TEXT("Failed to join lobby. Error: %s"),
-            UTF8_TO_TCHAR(EOS_EResult_ToString(Data->ResultCode)));
-    }
+    // Writes queued while this update was in flight
+    LobbyManager->ScheduleLobbyModificationFlush();
 }
 
-void UEOSLobbyManager::OnLeaveLobbyComplete(const EOS_Lobby_LeaveLobbyCallbackInfo* Data)
+void UEOSLobbyManager::HandleReadyStatusUpdated(EOS_EResult Result)
 {
-    UEOSLobbyManager* LobbyManager = static_cast<UEOSLobbyManager*>(Data->ClientData);
-    if (!IsValid(LobbyManager))
+    if (Result == EOS_EResult::EOS_Success)
     {
-        return; // Don't access destroyed object
+        EM_LOG_INFO(TEXT("Ready status updated successfully"));
     }
-
-    if (Data->ResultCode == EOS_EResult::EOS_Success)
+    else if (FEOSOperation::IsTransient(Result))
     {
-        
-        // Stop taking p2p requestss
-		LobbyManager->UnregisterTimerForTickP2PMessages(LobbyManager);
-        LobbyManager->UnregisterLobbyNotifications();
-
-        LobbyManager->bIsInLobby = false;
-        LobbyManager->CurrentLobbyId.Empty();
-        
-		LobbyManager->OnLobbyLeft.Broadcast();
-
-        EM_LOG_INFO(TEXT("Successfully left lobby"));
+        // The update was already retried with backoff, the next ready toggle sends it again
+        EM_LOG_WARNING(TEXT("Ready status update gave up - lobby service may be slow: %s"),
+            UTF8_TO_TCHAR(EOS_EResult_ToString(Result)));
     }
     else
     {
-        EM_LOG_ERROR(TEXT("Failed to leave lobby. Error: %s"),
-            UTF8_TO_TCHAR(EOS_EResult_ToString(Data->ResultCode)));
+        EM_LOG_ERROR(TEXT("Failed to update ready status: %s"),
+            UTF8_TO_TCHAR(EOS_EResult_ToString(Result)));
     }
 }
 
-void UEOSLobbyManager::OnDestroyLobbyComplete(const EOS_Lobby_DestroyLobbyCallbackInfo* Data)
+FString UEOSLobbyManager::UserIdToString(EOS_ProductUserId UserId) const
 {
-    UEOSLobbyManager* LobbyManager = static_cast<UEOSLobbyManager*>(Data->ClientData);
-    if (!IsValid(LobbyManager))
+    if (!UserId)
     {
-        return;
+        return FString();
     }
 
-    if (Data->ResultCode == EOS_EResult::EOS_Success)
+    char UserIdStr[EOS_PRODUCTUSERID_MAX_LENGTH + 1];
+    int32 BufferSize = sizeof(UserIdStr);
+    if (EOS_ProductUserId_ToString(UserId, UserIdStr, &BufferSize) == EOS_EResult::EOS_Success)
     {
-        LobbyManager->bIsInLobby = false;
-        LobbyManager->CurrentLobbyId.Empty();
-
-        EM_LOG_INFO(TEXT("Successfully destroyed lobby"));
+        return FString(UTF8_TO_TCHAR(UserIdStr));
     }
-    else
+
+    return FString();
+}
+
+FString UEOSLobbyManager::GetMemberIdString(EOS_ProductUserId UserId) const
+{
+    if (const FLobbyMemberInfo* MemberInfo = LobbyMembers.Find(UserId))
     {
-        EM_LOG_ERROR(TEXT("Failed to destroy lobby. Error: %s"),
-            UTF8_TO_TCHAR(EOS_EResult_ToString(Data->ResultCode)));
+        return MemberInfo->UserIdString;
     }
+
+    return UserIdToString(UserId);
 }
 
-void UEOSLobbyManager::OnFindLobbiesComplete(const EOS_LobbySearch_FindCallbackInfo* Data)
+void UEOSLobbyManager::SetPlayerRating(double Rating)
 {
-    UEOSLobbyManager* LobbyManager = static_cast<UEOSLobbyManager*>(Data->ClientData);
-    if (!IsValid(LobbyManager))
+    LocalPlayerRating = Rating;
+    if (bIsInLobby)
     {
-        return; // Don't access destroyed object
+        PublishPlayerRating();
     }
+}
 
-    if (Data->ResultCode == EOS_EResult::EOS_Success)
+void UEOSLobbyManager::PublishPlayerRating()
+{
+    if (LocalPlayerRating.IsSet())
     {
-        LobbyManager->FoundLobbies.Empty();
-
-        EOS_LobbySearch_GetSearchResultCountOptions CountOptions = {};
-        CountOptions.ApiVersion = EOS_LOBBYSEARCH_GETSEARCHRESULTCOUNT_API_LATEST;
-        uint32_t LobbyCount = EOS_LobbySearch_GetSearchResultCount(LobbyManager->CurrentLobbySearchHandle, &CountOptions);
-
-        // Go through each lobby
-        for (uint32_t i = 0; i < LobbyCount; i++)
-        {
-            EOS_LobbySearch_CopySearchResultByIndexOptions CopyOptions = {};
-            CopyOptions.ApiVersion = EOS_LOBBYSEARCH_COPYSEARCHRESULTBYINDEX_API_LATEST;
-            CopyOptions.LobbyIndex = i;
-
-            EOS_HLobbyDetails LobbyDetails = nullptr;
-            EOS_EResult CopyResult = EOS_LobbySearch_CopySearchResultByIndex(LobbyManager->CurrentLobbySearchHandle, &CopyOptions, &LobbyDetails);
-
-            if (CopyResult == EOS_EResult::EOS_Success && LobbyDetails)
-            {
-                EOS_LobbyDetails_CopyInfoOptions InfoOptions = {};
-                InfoOptions.ApiVersion = EOS_LOBBYDETAILS_COPYINFO_API_LATEST;
-
-                EOS_LobbyDetails_Info* LobbyInfo = nullptr;
-                if (EOS_LobbyDetails_CopyInfo(LobbyDetails, &InfoOptions, &LobbyInfo) == EOS_EResult::EOS_Success)
-                {
-                    // Create lobby info struct
-                    FLobbyInfo LobbyInfoStruct;
-                    LobbyInfoStruct.LobbyId = UTF8_TO_TCHAR(LobbyInfo->LobbyId);
-                    LobbyInfoStruct.MaxPlayers = LobbyInfo->MaxMembers;
-                    LobbyInfoStruct.CurrentPlayers = LobbyInfo->MaxMembers - LobbyInfo->AvailableSlots;
-                    LobbyInfoStruct.BucketId = UTF8_TO_TCHAR(LobbyInfo->BucketId ? LobbyInfo->BucketId : "");
-
-                    // Convert owner ProductUserId to string
-                    if (LobbyInfo->LobbyOwnerUserId)
-                    {
-                        char OwnerIdStr[EOS_PRODUCTUSERID_MAX_LENGTH + 1];
-                        int32_t BufferSize = sizeof(OwnerIdStr);
-                        if (EOS_ProductUserId_ToString(LobbyInfo->LobbyOwnerUserId, OwnerIdStr, &BufferSize) == EOS_EResult::EOS_Success)
-                        {
-                            LobbyInfoStruct.OwnerUserId = UTF8_TO_TCHAR(OwnerIdStr);
-                        }
-                        else
-                        {
-                            LobbyInfoStruct.OwnerUserId = TEXT("Unknown");
-                        }
-                    }
-                    else
-                    {
-                        LobbyInfoStruct.OwnerUserId = TEXT("No Owner");
-                    }
-
-                    LobbyInfoStruct.LobbyName = TEXT("Unnamed Lobby"); // Default
-                    LobbyManager->FoundLobbies.Add(LobbyInfoStruct);
-
-                    EM_LOG_INFO(TEXT("Found lobby: %s (Owner: %s, Players: %d/%d)"),
-                        *LobbyInfoStruct.LobbyId,
-                        *LobbyInfoStruct.OwnerUserId,
-                        LobbyInfoStruct.CurrentPlayers,
-                        LobbyInfoStruct.MaxPlayers);
-
-                    EOS_LobbyDetails_Info_Release(LobbyInfo);
-                }
-
-                EOS_LobbyDetails_Release(LobbyDetails);
-            }
-        }
+        SetLobbyAttribute(ELobbyAttributeScope::Member, LobbyAttributeKeys::Rating, FLobbyAttributeValue::MakeDouble(LocalPlayerRating.GetValue()));
+    }
+}
 
-        if (LobbyCount == 0)
+void UEOSLobbyManager::HandleOwnerPromoted(EOS_ProductUserId NewOwnerId)
+{
+    if (!LobbySnapshot.IsValid())
+    {
+        // Nothing to patch, read it all
+        RefreshLobbySnapshot();
+        UpdateLobbyMembersData();
+    }
+    else
+    {
+        // Owner flag changes for two members, everything else stays
+        LobbySnapshot = LobbySnapshot->WithOwner(NewOwnerId, ++LobbySnapshotVersion);
+        for (FLobbyMemberInfo& Member : LobbyMembers)
         {
-            EM_LOG_WARNING(TEXT("No lobbies found matching the search criteria"));
-		}
-
-        LobbyManager->OnLobbiesFound.Broadcast(LobbyManager->FoundLobbies);
+            Member.bIsLobbyOwner = (Member.UserId == NewOwnerId);
+        }
     }
 
-    // Clean up the search handle
-    if (LobbyManager->CurrentLobbySearchHandle)
+    const bool bIsLocalOwner = (NewOwnerId == LocalUserId);
+    const FString NewOwnerIdString = GetMemberIdString(NewOwnerId);
+    EM_LOG_INFO(TEXT("Lobby owner is now %s%s"), *NewOwnerIdString, bIsLocalOwner ? TEXT(" (us)") : TEXT(""));
+
+    if (bIsLocalOwner)
     {
-        EOS_LobbySearch_Release(LobbyManager->CurrentLobbySearchHandle);
-        LobbyManager->CurrentLobbySearchHandle = nullptr;
+        TakeOverOwnerDuties();
     }
 
-    EM_LOG_INFO(TEXT("Lobby search was completed"));
+    OnLobbyOwnerChanged.Broadcast(NewOwnerIdString, bIsLocalOwner);
+    OnLobbyMembersChanged.Broadcast();
 }
 
-void UEOSLobbyManager::OnFindLobbyToJoinComplete(const EOS_LobbySearch_FindCallbackInfo* Data)
+void UEOSLobbyManager::TakeOverOwnerDuties()
 {
-    UEOSLobbyManager* LobbyManager = static_cast<UEOSLobbyManager*>(Data->ClientData);
-    if (!IsValid(LobbyManager))
+    // Old owner may have left between joining the session and sharing it, members are waiting for the address
+    if (EOSManager)
     {
-		EM_LOG_ERROR(TEXT("LobbyManager is no longer valid in OnFindLobbyToJoinComplete"));
-        return; // Don't access destroyed objects
+        if (UEOSSessionManager* SessionManager = EOSManager->GetSessionManager())
+        {
+            const FString SessionId = SessionManager->GetJoinedSessionId();
+            if (!SessionId.IsEmpty() && SessionId != GetLobbySessionAddress())
+            {
+                EM_LOG_INFO(TEXT("[OWNER] Republishing session %s after host migration"), *SessionId);
+                SetLobbySessionAddress(SessionId);
+            }
+        }
     }
 
-    if (Data->ResultCode == EOS_EResult::EOS_Success)
+    // Ready check starts over for the new owner, so OnAllPlayersReady fires again if everyone already is
+    bBroadcastAllReady = false;
+    BroadcastReadyStateChanges();
+
+    UpdateLobbyRating();
+}
+
+void UEOSLobbyManager::ScheduleSessionJoin(const FString& SessionId)
+{
+    UWorld* World = GEngine->GetWorldFromContextObject(this, EGetWorldErrorMode::ReturnNull);
+    if (!World)
     {
-        // Get the lobby details handle from search results
-        EOS_LobbySearch_CopySearchResultByIndexOptions CopyOptions = {};
-        CopyOptions.ApiVersion = EOS_LOBBYSEARCH_COPYSEARCHRESULTBYINDEX_API_LATEST;
-        CopyOptions.LobbyIndex = 0; // First (and only) result
+        EM_LOG_ERROR(TEXT("[MEMBER] No world to schedule the session join in"));
+        return;
+    }
 
-        EOS_HLobbyDetails LobbyDetails = nullptr;
-        EOS_EResult CopyResult = EOS_LobbySearch_CopySearchResultByIndex(LobbyManager->CurrentLobbySearchHandle, &CopyOptions, &LobbyDetails);
+    World->GetTimerManager().ClearTimer(SessionJoinTimer);
+    SessionJoinId = SessionId;
+    SessionJoinAttempts = 0;
+    SessionJoinStartTime = FPlatformTime::Seconds();
+    SessionJoinSlot = LobbySnapshot.IsValid() ? FMath::Max(0, SessionJoinSchedule::GetSlot(*LobbySnapshot, LocalUserId)) : 0;
 
-        if (CopyResult == EOS_EResult::EOS_Success && LobbyDetails)
-        {
-            // Now we can join with the proper lobby details handle
-            EOS_Lobby_JoinLobbyOptions JoinOptions = {};
-            JoinOptions.ApiVersion = EOS_LOBBY_JOINLOBBY_API_LATEST;
-            JoinOptions.LocalUserId = LobbyManager->LocalUserId;
-            JoinOptions.LobbyDetailsHandle = LobbyDetails;
+    const float Delay = SessionJoinSchedule::GetJoinDelay(SessionJoinSlot, UEasyMatchmakingSettings::Get()->SessionJoinSlotSpacing);
+    EM_LOG_INFO(TEXT("[MEMBER] Joining session %s in slot %d, in %.2f seconds"), *SessionId, SessionJoinSlot, Delay);
 
-            EM_LOG_INFO(TEXT("Joining lobby with valid details handle"));
-            EOS_Lobby_JoinLobby(LobbyManager->LobbyHandle, &JoinOptions, LobbyManager, OnJoinLobbyComplete);
-        }
-        else
-        {
-            EM_LOG_ERROR(TEXT("Failed to get lobby details for joining"));
-        }
-    }
-    else
+    if (Delay > 0.0f)
     {
-        EM_LOG_ERROR(TEXT("Failed to find lobby to join"));
+        World->GetTimerManager().SetTimer(SessionJoinTimer, this, &UEOSLobbyManager::AttemptSessionJoin, Delay, false);
     }
-
-    // Clean up search handle
-    if (LobbyManager->CurrentLobbySearchHandle)
+    else
     {
-        EOS_LobbySearch_Release(LobbyManager->CurrentLobbySearchHandle);
-        LobbyManager->CurrentLobbySearchHandle = nullptr;
+        AttemptSessionJoin();
     }
 }
 
-// Check if still in lobby, with EOS (not just by comparing bool)
-bool UEOSLobbyManager::CheckWithEOSIsInLobby()
+void UEOSLobbyManager::AttemptSessionJoin()
 {
-    if (CurrentLobbyId.IsEmpty())
+    UEOSSessionManager* SessionManager = EOSManager ? EOSManager->GetSessionManager() : nullptr;
+    if (SessionJoinId.IsEmpty() || !SessionManager)
     {
-        EM_LOG_INFO(TEXT("CheckingIsInLobby: CurrentLobbyId == null"));
-        return false;
+        FinishSessionJoin();
+        return;
     }
 
-    // Try to get current lobby details to verify we are still a member
-    EOS_Lobby_CopyLobbyDetailsHandleOptions CopyOptions = {};
-    CopyOptions.ApiVersion = EOS_LOBBY_COPYLOBBYDETAILSHANDLE_API_LATEST;
-    CopyOptions.LocalUserId = LocalUserId;
-
-    FTCHARToUTF8 LobbyIdConverter(*CurrentLobbyId);
-    CopyOptions.LobbyId = LobbyIdConverter.Get();
-
-    EOS_HLobbyDetails LobbyDetails = nullptr;
-    EOS_EResult Result = EOS_Lobby_CopyLobbyDetailsHandle(LobbyHandle, &CopyOptions, &LobbyDetails);
-
-    if (Result == EOS_EResult::EOS_Success && LobbyDetails)
+    SessionJoinAttempts++;
+    if (!SessionJoinHandle.IsValid())
     {
-        EOS_LobbyDetails_Release(LobbyDetails);
-        bIsInLobby = true;
-        return true; // Successfully got lobby details, so we're still in it
+        SessionJoinHandle = SessionManager->OnSessionOperationComplete.AddUObject(this, &UEOSLobbyManager::HandleSessionJoinComplete);
     }
 
-    // Failed to get lobby details - we might have been kicked or lobby was destroyed
-    bIsInLobby = false;
-    CurrentLobbyId.Empty();
-    return false;
+    // With the server in the lobby we travel right away and the session search + join runs alongside,
+    // retries only register again (the session manager won't travel twice)
+    FLobbySessionServer Server;
+    if (GetLobbySessionServer(Server) && Server.SessionId == SessionJoinId)
+    {
+        SessionManager->JoinSessionAtAddress(SessionJoinId, Server.ServerAddress);
+    }
+    else
+    {
+        SessionManager->JoinSessionById(SessionJoinId);
+    }
 }
 
-void UEOSLobbyManager::UpdateLobbyMembersData()
+void UEOSLobbyManager::HandleSessionJoinComplete(ESessionOperation Operation, EOS_EResult Result, const FString& SessionId, int32 RequestId)
 {
-
-    if (!bIsInLobby || CurrentLobbyId.IsEmpty() || !LobbyHandle || !LocalUserId)
+    if (Operation != ESessionOperation::Join || SessionJoinId.IsEmpty() || SessionId != SessionJoinId)
     {
-        EM_LOG_WARNING(TEXT("Not in a lobby or invalid handles"));
+        return;
     }
 
-    EOS_Lobby_CopyLobbyDetailsHandleOptions CopyOptions = {};
-    CopyOptions.ApiVersion = EOS_LOBBY_COPYLOBBYDETAILSHANDLE_API_LATEST;
-    CopyOptions.LocalUserId = LocalUserId;
-
-    FTCHARToUTF8 LobbyIdConverter(*CurrentLobbyId);
-    CopyOptions.LobbyId = LobbyIdConverter.Get();
-
-    EOS_HLobbyDetails LobbyDetails = nullptr;
-    EOS_EResult Result = EOS_Lobby_CopyLobbyDetailsHandle(LobbyHandle, &CopyOptions, &LobbyDetails);
-
-    if (Result == EOS_EResult::EOS_Success && LobbyDetails)
+    // The session manager travels on SessionAlreadyExists too, asking again would get the same answer
+    if (Result == EOS_EResult::EOS_Success || Result == EOS_EResult::EOS_Sessions_SessionAlreadyExists)
     {
-        // Get lobby info to find the owner
-        EOS_LobbyDetails_CopyInfoOptions InfoOptions = {};
-        InfoOptions.ApiVersion = EOS_LOBBYDETAILS_COPYINFO_API_LATEST;
+        EM_LOG_INFO(TEXT("[MEMBER] Joined session %s %.2f seconds after the handoff (slot %d, try %d)"),
+            *SessionId, FPlatformTime::Seconds() - SessionJoinStartTime, SessionJoinSlot, SessionJoinAttempts);
 
-        EOS_LobbyDetails_Info* LobbyInfo = nullptr;
-        if (EOS_LobbyDetails_CopyInfo(LobbyDetails, &InfoOptions, &LobbyInfo) == EOS_EResult::EOS_Success)
+        // Tells the owner we're in. Sent right away, travel is about to start.
+        if (bIsInLobby)
         {
-            EOS_ProductUserId LobbyOwnerId = LobbyInfo->LobbyOwnerUserId;
-
-            // Get member count
-            EOS_LobbyDetails_GetMemberCountOptions MemberCountOptions = {};
-            MemberCountOptions.ApiVersion = EOS_LOBBYDETAILS_GETMEMBERCOUNT_API_LATEST;
-
-            uint32_t MemberCount = EOS_LobbyDetails_GetMemberCount(LobbyDetails, &MemberCountOptions);
-            EM_LOG_INFO(TEXT("Lobby has %d members"), MemberCount);
-
-            // Get each member's info
-            for (uint32_t i = 0; i < MemberCount; i++)
-            {
-                EOS_LobbyDetails_GetMemberByIndexOptions MemberOptions = {};
-                MemberOptions.ApiVersion = EOS_LOBBYDETAILS_GETMEMBERBYINDEX_API_LATEST;
-                MemberOptions.MemberIndex = i;
-
-                EOS_ProductUserId MemberUserId = EOS_LobbyDetails_GetMemberByIndex(LobbyDetails, &MemberOptions);
-
-                if (MemberUserId)
-                {
-                    FLobbyMemberInfo& MemberInfoInMap = LobbyMembers.FindOrAdd(UserIdToString(MemberUserId));
-
-                    // Convert ProductUserId to string
-                	MemberInfoInMap.UserId = MemberUserId;
-                    // Check if this member is the lobby owner
-                    MemberInfoInMap.bIsLobbyOwner = (MemberUserId == LobbyOwnerId);
-
-                    // Read member attributes to get ready status
-                    EOS_LobbyDetails_GetMemberAttributeCountOptions AttrCountOptions = {};
-                    AttrCountOptions.ApiVersion = EOS_LOBBYDETAILS_GETMEMBERATTRIBUTECOUNT_API_LATEST;
-                    AttrCountOptions.TargetUserId = MemberUserId;
-
-                    // Check each attribute for ready status
-                    uint32_t AttributeCount = EOS_LobbyDetails_GetMemberAttributeCount(LobbyDetails, &AttrCountOptions);
-                    for (uint32_t AttrIndex = 0; AttrIndex < AttributeCount; AttrIndex++)
-                    {
-                        EOS_LobbyDetails_CopyMemberAttributeByIndexOptions AttrOptions = {};
-                        AttrOptions.ApiVersion = EOS_LOBBYDETAILS_COPYMEMBERATTRIBUTEBYINDEX_API_LATEST;
-                        AttrOptions.TargetUserId = MemberUserId;
-                        AttrOptions.AttrIndex = AttrIndex;
-
-                        EOS_Lobby_Attribute* Attribute = nullptr; // Single pointer
-                        EOS_EResult AttrResult = EOS_LobbyDetails_CopyMemberAttributeByIndex(LobbyDetails, &AttrOptions, &Attribute);
-
-                        if (AttrResult == EOS_EResult::EOS_Success && Attribute)
-                        {
-                            // Access the attribute data correctly
-                            FString AttributeKey = FString(UTF8_TO_TCHAR(Attribute->Data->Key));
-                            if (AttributeKey == TEXT("ready"))
-                            {
-                                MemberInfoInMap.bIsReady = (Attribute->Data->Value.AsBool == EOS_TRUE);
-                                EM_LOG_INFO(TEXT("Member %s ready status: %s"),
-                                    *UserIdToString(MemberUserId),
-                                    MemberInfoInMap.bIsReady ? TEXT("Ready") : TEXT("Not Ready"));
-                            }
-
-                            // Release the attribute as per documentation
-                            EOS_Lobby_Attribute_Release(Attribute);
-                        }
-                    }
-                }
-            }
-
-            EOS_LobbyDetails_Info_Release(LobbyInfo);
+            SetLobbyAttribute(ELobbyAttributeScope::Member, LobbyAttributeKeys::JoinedSession, FLobbyAttributeValue::MakeString(SessionId));
+            FlushLobbyModificationsNow();
         }
+        FinishSessionJoin();
+        return;
+    }
 
-        EOS_LobbyDetails_Release(LobbyDetails);
-
-        for (const TPair<FString, FLobbyMemberInfo>& Elem : LobbyMembers)
-        {
-            const FString& ProductUserIdString = Elem.Key;
-            const FLobbyMemberInfo& MemberInfo = Elem.Value;
+    const UEasyMatchmakingSettings* Settings = UEasyMatchmakingSettings::Get();
+    UWorld* World = GEngine->GetWorldFromContextObject(this, EGetWorldErrorMode::ReturnNull);
+    if (World && SessionJoinSchedule::IsBusy(Result) && SessionJoinAttempts < Settings->SessionJoinMaxAttempts)
+    {
+        const float Delay = SessionJoinSchedule::GetRetryDelay(SessionJoinSlot, SessionJoinAttempts + 1,
+            Settings->SessionJoinSlotSpacing, Settings->SessionJoinRetryDelay);
+        EM_LOG_WARNING(TEXT("[MEMBER] Session busy (%s), trying again in %.2f seconds"),
+            UTF8_TO_TCHAR(EOS_EResult_ToString(Result)), Delay);
 
-            UE_LOG(LogTemp, Log, TEXT("Member [%s]: DisplayName=%s, Owner=%s"),
-                *ProductUserIdString,
-                *MemberInfo.DisplayName,
-                MemberInfo.bIsLobbyOwner ? TEXT("Yes") : TEXT("No"));
+        World->GetTimerManager().SetTimer(SessionJoinTimer, this, &UEOSLobbyManager::AttemptSessionJoin, FMath::Max(Delay, 0.01f), false);
+        return;
+    }
 
-            if (MemberInfo.DisplayName.IsEmpty())
-            {
-                GetUserDisplayName(MemberInfo.UserId);
-            }
-        }
+    const FString Error = FString::Printf(TEXT("Could not join session %s after %d tries: %s"),
+        *SessionId, SessionJoinAttempts, UTF8_TO_TCHAR(EOS_EResult_ToString(Result)));
+    EM_LOG_ERROR(TEXT("[MEMBER] %s"), *Error);
+    FinishSessionJoin();
+    OnLobbyError.Broadcast(Error);
+}
 
+void UEOSLobbyManager::FinishSessionJoin()
+{
+    if (UWorld* World = GEngine->GetWorldFromContextObject(this, EGetWorldErrorMode::ReturnNull))
+    {
+        World->GetTimerManager().ClearTimer(SessionJoinTimer);
     }
-    else
+
+    if (SessionJoinHandle.IsValid())
     {
-        EM_LOG_ERROR(TEXT("Failed to get lobby details for member list"));
+        if (UEOSSessionManager* SessionManager = EOSManager ? EOSManager->GetSessionManager() : nullptr)
+        {
+            SessionManager->OnSessionOperationComplete.Remove(SessionJoinHandle);
+        }
+        SessionJoinHandle.Reset();
     }
+
+    SessionJoinId.Empty();
 }
 
-void UEOSLobbyManager::GetUserDisplayName(EOS_ProductUserId UserId)
+void UEOSLobbyManager::StartSessionHandoff(const FString& SessionId)
 {
+    if (SessionId.IsEmpty() || SessionId == HandoffSessionId)
+    {
+        return;
+    }
 
-    // Query the mapping from ProductUserId to external accounts
-    EOS_HConnect ConnectHandle = EOS_Platform_GetConnectInterface(PlatformHandle);
+    CancelSessionHandoff();
+    HandoffSessionId = SessionId;
+    HandoffStartTime = FPlatformTime::Seconds();
 
-    EOS_Connect_QueryProductUserIdMappingsOptions QueryOptions = {};
-    QueryOptions.ApiVersion = EOS_CONNECT_QUERYPRODUCTUSERIDMAPPINGS_API_LATEST;
-    QueryOptions.LocalUserId = LocalUserId; // Your ProductUserId
-    QueryOptions.ProductUserIds = &UserId;
-    QueryOptions.ProductUserIdCount = 1;
-    
-    FUserQueryContext* Context = new FUserQueryContext;
-    Context->LobbyManager = this;
-    Context->TargetUserId = UserId;
+    TWeakObjectPtr<UEOSLobbyManager> WeakThis(this);
+    HandoffOperationId = FEOSOperationTracker::Get().Begin(TEXT("SessionHandoff"), UEasyMatchmakingSettings::Get()->SessionHandoffTimeout,
+        [WeakThis]()
+        {
+            if (UEOSLobbyManager* LobbyManager = WeakThis.Get())
+            {
+                LobbyManager->HandoffOperationId = 0;
+                LobbyManager->HandoffSessionId.Empty();
+            }
+        });
 
-    EM_LOG_INFO(TEXT("Querying ProductUserId mapping for display name"));
-    EOS_Connect_QueryProductUserIdMappings(ConnectHandle, &QueryOptions, Context, OnQueryProductUserIdMappingsComplete);
+    // Members who joined before (owner migration) or a lobby without members finish right away
+    CheckSessionHandoff();
 }
 
-FString UEOSLobbyManager::GetLobbySessionAddress()
+void UEOSLobbyManager::CheckSessionHandoff()
 {
-    if (!bIsInLobby || CurrentLobbyId.IsEmpty() || !LobbyHandle || !LocalUserId)
+    if (HandoffSessionId.IsEmpty() || !LobbySnapshot.IsValid() || !IsLobbyOwner())
     {
-        EM_LOG_ERROR(TEXT("Cannot get session address - not in lobby"));
-        return FString();
+        return;
     }
 
-    EOS_Lobby_CopyLobbyDetailsHandleOptions CopyOptions = {};
-    CopyOptions.ApiVersion = EOS_LOBBY_COPYLOBBYDETAILSHANDLE_API_LATEST;
-    CopyOptions.LocalUserId = LocalUserId;
-
-    FTCHARToUTF8 LobbyIdConverter(*CurrentLobbyId);
-    CopyOptions.LobbyId = LobbyIdConverter.Get();
-
-    EOS_HLobbyDetails LobbyDetails = nullptr;
-    EOS_EResult Result = EOS_Lobby_CopyLobbyDetailsHandle(LobbyHandle, &CopyOptions, &LobbyDetails);
-
-    FString SessionAddress;
-    if (Result == EOS_EResult::EOS_Success && LobbyDetails)
+    if (!SessionJoinSchedule::HaveAllMembersJoined(*LobbySnapshot, HandoffSessionId))
     {
-        // Get attribute count
-        EOS_LobbyDetails_GetAttributeCountOptions AttrCountOptions = {};
-        AttrCountOptions.ApiVersion = EOS_LOBBYDETAILS_GETATTRIBUTECOUNT_API_LATEST;
+        return;
+    }
 
-        uint32_t AttributeCount = EOS_LobbyDetails_GetAttributeCount(LobbyDetails, &AttrCountOptions);
+    const float Seconds = FPlatformTime::Seconds() - HandoffStartTime;
+    EM_LOG_INFO(TEXT("All %d members joined session %s %.2f seconds after the handoff"),
+        FMath::Max(0, LobbySnapshot->Members.Num() - 1), *HandoffSessionId, Seconds);
 
-        // Search for session_address attribute
-        for (uint32_t i = 0; i < AttributeCount; i++)
-        {
-            EOS_LobbyDetails_CopyAttributeByIndexOptions AttrOptions = {};
-            AttrOptions.ApiVersion = EOS_LOBBYDETAILS_COPYATTRIBUTEBYINDEX_API_LATEST;
-            AttrOptions.AttrIndex = i;
+    FEOSOperationTracker::Get().Complete(HandoffOperationId, true);
+    HandoffOperationId = 0;
+    HandoffSessionId.Empty();
 
-            EOS_Lobby_Attribute* Attribute = nullptr;
-            EOS_EResult AttrResult = EOS_LobbyDetails_CopyAttributeByIndex(LobbyDetails, &AttrOptions, &Attribute);
+    OnAllMembersJoinedSession.Broadcast(Seconds);
+}
 
-            if (AttrResult == EOS_EResult::EOS_Success && Attribute)
-            {
-                FString AttributeKey = UTF8_TO_TCHAR(Attribute->Data->Key);
+void UEOSLobbyManager::CancelSessionHandoff()
+{
+    if (HandoffOperationId != 0)
+    {
+        FEOSOperationTracker::Get().Cancel(HandoffOperationId);
+    }
+    HandoffOperationId = 0;
+    HandoffSessionId.Empty();
+}
 
-                if (AttributeKey == TEXT("session_address"))
-                {
-                    SessionAddress = UTF8_TO_TCHAR(Attribute->Data->Value.AsUtf8);
-                    EM_LOG_INFO(TEXT("Found session address in lobby: %s"), *SessionAddress);
+void UEOSLobbyManager::StartLobbyRejoin(const FString& LobbyId)
+{
+    const UEasyMatchmakingSettings* Settings = UEasyMatchmakingSettings::Get();
+    if (LobbyId.IsEmpty() || Settings->LobbyRejoinMaxAttempts <= 0 || IsQuickMatchRunning())
+    {
+        return;
+    }
 
-                    EOS_Lobby_Attribute_Release(Attribute);
-                    break;
-                }
+    RejoinLobbyId = LobbyId;
+    RejoinAttempts = 0;
+    RejoinMemberAttributes = LastLocalMemberLobbyId == LobbyId ? LastLocalMemberAttributes : TArray<FLobbyAttributeValue>();
 
-                EOS_Lobby_Attribute_Release(Attribute);
-            }
-        }
+    EM_LOG_INFO(TEXT("Lost lobby %s, rejoining"), *LobbyId);
+    ScheduleLobbyRejoin();
+}
 
-        EOS_LobbyDetails_Release(LobbyDetails);
+void UEOSLobbyManager::ScheduleLobbyRejoin()
+{
+    UWorld* World = GEngine->GetWorldFromContextObject(this, EGetWorldErrorMode::ReturnNull);
+    if (!World)
+    {
+        FinishLobbyRejoin(false);
+        return;
     }
 
-    return SessionAddress;
+    // Exponential backoff with jitter, so a whole party dropped by the same hiccup doesn't come back in lockstep
+    const UEasyMatchmakingSettings* Settings = UEasyMatchmakingSettings::Get();
+    const float Backoff = FMath::Min(Settings->LobbyRejoinInitialDelay * FMath::Pow(2.0f, RejoinAttempts), Settings->LobbyRejoinMaxDelay);
+    const float Delay = FMath::Max(0.05f, Backoff * FMath::FRandRange(0.5f, 1.0f));
+
+    World->GetTimerManager().SetTimer(RejoinTimer, this, &UEOSLobbyManager::AttemptLobbyRejoin, Delay, false);
 }
 
-void UEOSLobbyManager::OnQueryProductUserIdMappingsComplete(const EOS_Connect_QueryProductUserIdMappingsCallbackInfo* Data)
+void UEOSLobbyManager::AttemptLobbyRejoin()
 {
-	// Heap memory allocation (because functions can be called several times at once, to prevent data override we use heap memory allocation)
-    FUserQueryContext* Context = static_cast<FUserQueryContext*>(Data->ClientData);
-    UEOSLobbyManager* LobbyManager = Context->LobbyManager;
-
-    if (Data->ResultCode == EOS_EResult::EOS_Success)
+    if (!IsRejoiningLobby())
     {
-        EOS_HConnect ConnectHandle = EOS_Platform_GetConnectInterface(LobbyManager->PlatformHandle);
-        EOS_Connect_GetProductUserIdMappingOptions GetMappingOptions = {};
-        GetMappingOptions.ApiVersion = EOS_CONNECT_GETPRODUCTUSERIDMAPPING_API_LATEST;
-        GetMappingOptions.LocalUserId = LobbyManager->LocalUserId;
-        GetMappingOptions.TargetProductUserId = Context->TargetUserId;
-        GetMappingOptions.AccountIdType = EOS_EExternalAccountType::EOS_EAT_EPIC;
+        return;
+    }
 
-        char ExternalAccountId[EOS_CONNECT_EXTERNAL_ACCOUNT_ID_MAX_LENGTH + 1];
-        int32_t BufferSize = sizeof(ExternalAccountId);
+    if (bIsInLobby)
+    {
+        // Joined something else meanwhile
+        CancelLobbyRejoin();
+        return;
+    }
 
-        EOS_EResult MappingResult = EOS_Connect_GetProductUserIdMapping(ConnectHandle, &GetMappingOptions, ExternalAccountId, &BufferSize);
+    const UEasyMatchmakingSettings* Settings = UEasyMatchmakingSettings::Get();
+    if (RejoinAttempts >= Settings->LobbyRejoinMaxAttempts)
+    {
+        FinishLobbyRejoin(false);
+        return;
+    }
 
-        if (MappingResult == EOS_EResult::EOS_Success)
-        {
-            // Now we have the EpicAccountId, query user info
-            EOS_EpicAccountId TargetEpicAccountId = EOS_EpicAccountId_FromString(ExternalAccountId);
+    if (!LobbyHandle || !LocalUserId)
+    {
+        // Logged out meanwhile
+        FinishLobbyRejoin(false);
+        return;
+    }
 
-            EOS_HUserInfo UserInfoHandle = EOS_Platform_GetUserInfoInterface(LobbyManager->PlatformHandle);
+    RejoinAttempts++;
+    EM_LOG_INFO(TEXT("Rejoining lobby %s (attempt %d/%d)"), *RejoinLobbyId, RejoinAttempts, Settings->LobbyRejoinMaxAttempts);
 
-            EOS_UserInfo_QueryUserInfoOptions UserInfoQueryOptions = {};
-            UserInfoQueryOptions.ApiVersion = EOS_USERINFO_QUERYUSERINFO_API_LATEST;
-            UserInfoQueryOptions.LocalUserId = LobbyManager->LocalEpicAccountId;
-            UserInfoQueryOptions.TargetUserId = TargetEpicAccountId;
+    // The next attempt is armed when this one fails. A join that hangs is reported by the runner's deadline, we keep waiting for it.
+    JoinLobby(RejoinLobbyId);
+}
 
-            EOS_UserInfo_QueryUserInfo(UserInfoHandle, &UserInfoQueryOptions, Context, OnQueryUserInfoComplete);
-        }
-        else
-        {
-            EM_LOG_INFO(TEXT("No Epic account mapping found for ProductUserId"));
-            delete Context;
-        }
-    }
-    else
+void UEOSLobbyManager::HandleLobbyRejoinFailed(EOS_EResult Result)
+{
+    // Closed while we were away, no point in trying again
+    if (Result == EOS_EResult::EOS_NotFound || RejoinAttempts >= UEasyMatchmakingSettings::Get()->LobbyRejoinMaxAttempts)
     {
-        delete Context;
+        FinishLobbyRejoin(false);
+        return;
     }
+
+    ScheduleLobbyRejoin();
 }
 
-void UEOSLobbyManager::OnQueryUserInfoComplete(const EOS_UserInfo_QueryUserInfoCallbackInfo* Data)
+void UEOSLobbyManager::CancelLobbyRejoin()
 {
-    FUserQueryContext* Context = static_cast<FUserQueryContext*>(Data->ClientData);
-    UEOSLobbyManager* LobbyManager = Context->LobbyManager;
-	if (!IsValid(Context->LobbyManager)) //to avoid crashes on exit
+    if (!IsRejoiningLobby())
     {
-        delete Context;
         return;
     }
 
-    // Debug - Show the EpicAccountId being queried
-    char EpicAccountIdStr[EOS_EPICACCOUNTID_MAX_LENGTH + 1];
-    int32_t EpicBufferSize = sizeof(EpicAccountIdStr);
-    EOS_EpicAccountId_ToString(Data->TargetUserId, EpicAccountIdStr, &EpicBufferSize);
-    EM_LOG_INFO(TEXT("Query completed for EpicAccountId: %s"), UTF8_TO_TCHAR(EpicAccountIdStr));
-
-    // Debug - Show your local EpicAccountId
-    char LocalEpicIdStr[EOS_EPICACCOUNTID_MAX_LENGTH + 1];
-    int32_t LocalBufferSize = sizeof(LocalEpicIdStr);
-    EOS_EpicAccountId_ToString(LobbyManager->LocalEpicAccountId, LocalEpicIdStr, &LocalBufferSize);
-    EM_LOG_INFO(TEXT("Local EpicAccountId: %s"), UTF8_TO_TCHAR(LocalEpicIdStr));
-
-    // Log user ID 
-    char UserIdStr[EOS_PRODUCTUSERID_MAX_LENGTH + 1];
-    int32 BufferSize = sizeof(UserIdStr);
-    EOS_ProductUserId_ToString(LobbyManager->LocalUserId, UserIdStr, &BufferSize);
-    EM_LOG_INFO(TEXT("ProductUserId: %s"), UTF8_TO_TCHAR(UserIdStr));
+    EM_LOG_INFO(TEXT("Lobby rejoin cancelled: %s"), *RejoinLobbyId);
+    if (UWorld* World = GEngine->GetWorldFromContextObject(this, EGetWorldErrorMode::ReturnNull))
+    {
+        World->GetTimerManager().ClearTimer(RejoinTimer);
+    }
+    RejoinLobbyId.Empty();
+    RejoinMemberAttributes.Reset();
+    RejoinAttempts = 0;
+}
 
-    if (Data->ResultCode == EOS_EResult::EOS_Success)
+void UEOSLobbyManager::FinishLobbyRejoin(bool bRejoined)
+{
+    if (UWorld* World = GEngine->GetWorldFromContextObject(this, EGetWorldErrorMode::ReturnNull))
     {
-        EOS_HUserInfo UserInfoHandle = EOS_Platform_GetUserInfoInterface(LobbyManager->PlatformHandle);
+        World->GetTimerManager().ClearTimer(RejoinTimer);
+    }
 
-        EOS_UserInfo_CopyUserInfoOptions CopyOptions = {};
-        CopyOptions.ApiVersion = EOS_USERINFO_COPYUSERINFO_API_LATEST;
-        CopyOptions.LocalUserId = LobbyManager->LocalEpicAccountId;
-        CopyOptions.TargetUserId = Data->TargetUserId;
+    const FString LobbyId = MoveTemp(RejoinLobbyId);
+    const int32 Attempts = RejoinAttempts;
+    TArray<FLobbyAttributeValue> MemberAttributes = MoveTemp(RejoinMemberAttributes);
+    RejoinLobbyId.Empty();
+    RejoinMemberAttributes.Reset();
+    RejoinAttempts = 0;
 
-        EOS_UserInfo* UserInfo = nullptr;
-        EOS_EResult CopyResult = EOS_UserInfo_CopyUserInfo(UserInfoHandle, &CopyOptions, &UserInfo);
+    if (!bRejoined)
+    {
+        EM_LOG_WARNING(TEXT("Giving up on lobby %s after %d attempts"), *LobbyId, Attempts);
+        OnLobbyRejoinFailed.Broadcast(LobbyId, Attempts);
+        return;
+    }
 
-        if (CopyResult == EOS_EResult::EOS_Success && UserInfo)
+    // Ready flag and whatever else we had set, all in one update. The rating was already republished on join,
+    // the joined session belongs to a handoff that is over.
+    int32 Restored = 0;
+    for (int32 Slot = 0; Slot < MemberAttributes.Num(); Slot++)
+    {
+        if (Slot == FLobbyAttributeSchema::MemberRatingSlot || Slot == FLobbyAttributeSchema::JoinedSessionSlot)
         {
-            FString DisplayName = UTF8_TO_TCHAR(UserInfo->DisplayName);
-
-            // Use the ProductUserId from context to update the correct map entry
-            FString ProductUserIdString = LobbyManager->UserIdToString(Context->TargetUserId);
-
-            // Update the map entry with the display name
-            if (FLobbyMemberInfo* MemberInfo = LobbyManager->LobbyMembers.Find(ProductUserIdString))
-            {
-                MemberInfo->DisplayName = DisplayName;
-                EM_LOG_INFO(TEXT("Updated display name: %s for ProductUserId: %s"),
-                    *DisplayName, *ProductUserIdString);
-                LobbyManager->OnLobbyMemberEpicGameNicknameGot.Broadcast();
-            }
-
-            if (Context->TargetUserId == LobbyManager->LocalUserId)
-            {
-                LobbyManager->LocalPlayerDisplayName = DisplayName;
-                EM_LOG_INFO(TEXT("Saved local player name: %s"), *DisplayName);
-            }
-
-            EOS_UserInfo_Release(UserInfo);
+            continue;
         }
-        else
+
+        if (MemberAttributes[Slot].IsSet())
         {
-            EM_LOG_ERROR(TEXT("Failed to copy user info: %s"),
-                UTF8_TO_TCHAR(EOS_EResult_ToString(CopyResult)));
+            QueueLobbyAttribute(ELobbyAttributeScope::Member, Slot, MemberAttributes[Slot], nullptr);
+            Restored++;
         }
     }
-    else
-    {
-        EM_LOG_ERROR(TEXT("Query user info failed: %s"),
-            UTF8_TO_TCHAR(EOS_EResult_ToString(Data->ResultCode)));
-    }
-
 
-    delete Context;
+    EM_LOG_INFO(TEXT("Rejoined lobby %s after %d attempts, restoring %d member attributes"), *LobbyId, Attempts, Restored);
+    OnLobbyRejoined.Broadcast(LobbyId);
 }
 
-void UEOSLobbyManager::OnUpdateReadyStatusLobbyComplete(const EOS_Lobby_UpdateLobbyCallbackInfo* Data)
+void UEOSLobbyManager::UpdateLobbyRating()
 {
-    UEOSLobbyManager* LobbyManager = static_cast<UEOSLobbyManager*>(Data->ClientData);
-    if (!IsValid(LobbyManager)) return;
-   
+    if (!IsLobbyOwner())
+    {
+        return;
+    }
 
-    if (Data->ResultCode == EOS_EResult::EOS_Success)
+    double RatingSum = 0.0;
+    int32 RatedMembers = 0;
+    for (const FLobbySnapshotMember& Member : LobbySnapshot->Members)
     {
-        EM_LOG_INFO(TEXT("Ready status updated successfully"));
+        const FLobbyAttributeValue& MemberRating = FLobbySnapshot::GetAttributeFrom(Member.Attributes, FLobbyAttributeSchema::MemberRatingSlot);
+        if (MemberRating.Type == ELobbyAttributeType::Double)
+        {
+            RatingSum += MemberRating.DoubleValue;
+            RatedMembers++;
+        }
     }
-    else if (Data->ResultCode == EOS_EResult::EOS_TimedOut)
+
+    if (RatedMembers == 0)
     {
-        EM_LOG_WARNING(TEXT("Ready status update timed out - lobby service may be slow"));
-        // TODO: add retry logic later?
+        return;
     }
-    else
+
+    // Small drifts are not worth a lobby update, queued repeats replace each other
+    const double MeanRating = RatingSum / RatedMembers;
+    const FLobbyAttributeValue& Published = LobbySnapshot->GetAttribute(FLobbyAttributeSchema::LobbyRatingSlot);
+    if (Published.Type == ELobbyAttributeType::Double && FMath::Abs(Published.DoubleValue - MeanRating) < 1.0)
     {
-        EM_LOG_ERROR(TEXT("Failed to update ready status: %s"),
-            UTF8_TO_TCHAR(EOS_EResult_ToString(Data->ResultCode)));
+        return;
     }
+
+    SetLobbyAttribute(ELobbyAttributeScope::Lobby, LobbyAttributeKeys::Rating, FLobbyAttributeValue::MakeDouble(MeanRating));
 }
 
-FString UEOSLobbyManager::UserIdToString(EOS_ProductUserId UserId) const
+void UEOSLobbyManager::PublishLobbySummary(FOnLobbyModificationComplete OnComplete)
 {
-    if (!UserId)
-    {
-        return FString();
-    }
+    FLobbySummary Summary;
+    Summary.LobbyName = CurrentSettings.LobbyName;
+    Summary.GameMode = CurrentSettings.GameMode;
+    Summary.MapName = CurrentSettings.MapName;
+    Summary.Region = CurrentSettings.Region;
+    Summary.BuildId = CurrentSettings.BuildId;
+    Summary.bIsPrivate = CurrentSettings.bIsPrivate;
 
-    char UserIdStr[EOS_PRODUCTUSERID_MAX_LENGTH + 1];
-    int32 BufferSize = sizeof(UserIdStr);
-    if (EOS_ProductUserId_ToString(UserId, UserIdStr, &BufferSize) == EOS_EResult::EOS_Success)
+    // Separate from the summary so quick match can filter on it, both go out in the same batch
+    if (!CurrentSettings.Region.IsEmpty())
     {
-        return FString(UTF8_TO_TCHAR(UserIdStr));
+        SetLobbyAttribute(ELobbyAttributeScope::Lobby, LobbyAttributeKeys::Region, FLobbyAttributeValue::MakeString(CurrentSettings.Region));
     }
 
-    return FString();
+    SetLobbyAttribute(ELobbyAttributeScope::Lobby, LobbyAttributeKeys::Summary, FLobbyAttributeValue::MakeString(Summary.Encode()), MoveTemp(OnComplete));
 }
 
-void UEOSLobbyManager::OnSetSessionAddressComplete(const EOS_Lobby_UpdateLobbyCallbackInfo* Data)
+const TMap<FString, int32>& UEOSLobbyManager::GetRegionLatencies() const
 {
-    UEOSLobbyManager* LobbyManager = static_cast<UEOSLobbyManager*>(Data->ClientData);
-    if (!IsValid(LobbyManager))
+    static const TMap<FString, int32> NoLatencies;
+    return EOSManager ? EOSManager->GetRegionLatencyMap() : NoLatencies;
+}
+
+void UEOSLobbyManager::ApplyRegionLatencies(TArray<FLobbyInfo>& Lobbies) const
+{
+    const TMap<FString, int32>& Latencies = GetRegionLatencies();
+    for (FLobbyInfo& Lobby : Lobbies)
     {
-        return;
+        Lobby.LatencyMs = RegionLatency::Find(Latencies, Lobby.Region);
     }
+}
 
-    if (Data->ResultCode == EOS_EResult::EOS_Success)
+void UEOSLobbyManager::HandleSessionAddressUpdated(EOS_EResult Result)
+{
+    if (Result == EOS_EResult::EOS_Success)
     {
         EM_LOG_INFO(TEXT("Session address updated in lobby successfully"));
 
+        // Our own write is in the local lobby copy now, pick it up
+        RefreshLobbySnapshot();
+
         // Broadcast to all members
-        FString SessionAddress = LobbyManager->GetLobbySessionAddress();
-        LobbyManager->OnSessionAddressUpdated.Broadcast(SessionAddress);
+        FString SessionAddress = GetLobbySessionAddress();
+        OnSessionAddressUpdated.Broadcast(SessionAddress);
+
+        StartSessionHandoff(SessionAddress);
     }
     else
     {
         EM_LOG_ERROR(TEXT("Failed to update session address: %s"),
-            UTF8_TO_TCHAR(EOS_EResult_ToString(Data->ResultCode)));
+            UTF8_TO_TCHAR(EOS_EResult_ToString(Result)));
     }
 }
 
@@ -1642,13 +2881,10 @@ void UEOSLobbyManager::TickP2PMessages()
         {
             // Convert data to FString
             FString Message = UTF8_TO_TCHAR((char*)PacketData.GetData());
-            FString SenderName = UserIdToString(SenderUserId);
 
             // Get display name from cache
-            if (FLobbyMemberInfo* MemberInfo = LobbyMembers.Find(SenderName))
-            {
-                SenderName = MemberInfo->DisplayName;
-            }
+            const FLobbyMemberInfo* MemberInfo = LobbyMembers.Find(SenderUserId);
+            FString SenderName = MemberInfo ? MemberInfo->DisplayName : UserIdToString(SenderUserId);
 
             EM_LOG_INFO(TEXT("Chat from %s: %s"), *SenderName, *Message);
 
@@ -1689,10 +2925,10 @@ void UEOSLobbyManager::SendChatMessage(const FString& Message)
 
     // Send to each lobby member
     int32 SentCount = 0;
-    for (const auto& Member : LobbyMembers)
+    for (const FLobbyMemberInfo& Member : LobbyMembers)
     {
         // Skip sending to yourself
-        if (Member.Value.UserId == LocalUserId)
+        if (Member.UserId == LocalUserId)
         {
             continue;
         }
@@ -1700,7 +2936,7 @@ void UEOSLobbyManager::SendChatMessage(const FString& Message)
         EOS_P2P_SendPacketOptions SendOptions = {};
         SendOptions.ApiVersion = EOS_P2P_SENDPACKET_API_LATEST;
         SendOptions.LocalUserId = LocalUserId;
-        SendOptions.RemoteUserId = Member.Value.UserId;
+        SendOptions.RemoteUserId = Member.UserId;
         SendOptions.SocketId = &ChatSocketId;
         SendOptions.Channel = 0;
         SendOptions.DataLengthBytes = MessageConverter.Length() + 1; // +1 for null terminator
@@ -1713,12 +2949,12 @@ void UEOSLobbyManager::SendChatMessage(const FString& Message)
         if (Result == EOS_EResult::EOS_Success)
         {
             SentCount++;
-            EM_LOG_INFO(TEXT("Sent to %s"), *Member.Value.DisplayName);
+            EM_LOG_INFO(TEXT("Sent to %s"), *Member.DisplayName);
         }
         else
         {
             EM_LOG_WARNING(TEXT("Failed to send message to %s: %s"),
-                *Member.Value.DisplayName,
+                *Member.DisplayName,
                 UTF8_TO_TCHAR(EOS_EResult_ToString(Result)));
         }
     }
@@ -1,6 +1,7 @@
 // EOSManager.cpp
 #include "EOSManager.h"
 #include "EOSLobbyManager.h"  
+#include "Async/EOSOperationRunner.h"
 #include "IEOSSDKManager.h"
 #include "EasyMatchmakingLog.h"
 #include "EasyMatchmakingSettings.h"
@@ -13,6 +14,8 @@ void UEOSManager::Initialize(FSubsystemCollectionBase& Collection)
 {
     Super::Initialize(Collection);
 
+    OperationTimedOutHandle = FEOSOperationTracker::Get().OnTimedOut.AddUObject(this, &UEOSManager::HandleOperationTimedOut);
+
 	// Check if EOS SDK is initialized and if yes, then authenticate user (and load lobby manager)
     IEOSSDKManager* SDKManager = IEOSSDKManager::Get();
     if (SDKManager && SDKManager->IsInitialized())
@@ -67,10 +70,18 @@ void UEOSManager::Initialize(FSubsystemCollectionBase& Collection)
 
 void UEOSManager::Deinitialize()
 {
+    RegionProbe.Reset();
+    CircuitBreaker->Reset();
+    FEOSOperationTracker::Get().OnTimedOut.Remove(OperationTimedOutHandle);
     LobbyManager->LeaveLobby(); // TODO: add destructor
 	Super::Deinitialize();
 }
 
+void UEOSManager::HandleOperationTimedOut(const FString& Operation, uint64 OperationId, double Seconds)
+{
+    OnOperationTimedOut.Broadcast(Operation, static_cast<float>(Seconds));
+}
+
 bool UEOSManager::TestEOSInitialization()
 {
     IEOSSDKManager* SDKManager = IEOSSDKManager::Get();
@@ -139,8 +150,10 @@ void UEOSManager::AuthenticateUser()
         return;
     }
 
-    EOS_Auth_Credentials Credentials = {};
-    Credentials.ApiVersion = EOS_AUTH_CREDENTIALS_API_LATEST;
+    // Kept as strings, a retried login builds its credentials again
+    EOS_ELoginCredentialType LoginType = EOS_ELoginCredentialType::EOS_LCT_AccountPortal;
+    FString LoginId;
+    FString LoginToken;
 
     // Check for command line credentials FIRST
     FString DevAuthHost;
@@ -152,13 +165,13 @@ void UEOSManager::AuthenticateUser()
         EM_LOG_INFO(TEXT("Using Developer Auth from command line"));
         EM_LOG_INFO(TEXT("Host: %s, Token: %s"), *DevAuthHost, *DevAuthToken);
 
-        Credentials.Type = EOS_ELoginCredentialType::EOS_LCT_Developer;
+        LoginType = EOS_ELoginCredentialType::EOS_LCT_Developer;
 
         DevAuthHostStorage = DevAuthHost;
         DevAuthTokenStorage = DevAuthToken;
 
-        Credentials.Id = TCHAR_TO_UTF8(*DevAuthHostStorage);
-        Credentials.Token = TCHAR_TO_UTF8(*DevAuthTokenStorage);
+        LoginId = DevAuthHostStorage;
+        LoginToken = DevAuthTokenStorage;
     }
 	// Below code is for debugging to be able to run multiple PIE (game editor in engine) instances with different users
 #if WITH_EDITOR
@@ -171,9 +184,7 @@ void UEOSManager::AuthenticateUser()
         if (PIEInstance == 0)
         {
             // First PIE instance -> Epic Account login via website
-            Credentials.Type = EOS_ELoginCredentialType::EOS_LCT_AccountPortal;
-            Credentials.Id = nullptr;
-            Credentials.Token = nullptr;
+            LoginType = EOS_ELoginCredentialType::EOS_LCT_AccountPortal;
 
             EM_LOG_INFO(TEXT("PIE Instance 0: Using Epic Account login via website"));
         }
@@ -184,9 +195,9 @@ void UEOSManager::AuthenticateUser()
             if (Settings->TemporaryAccounts.IsValidIndex(TempIndex))
             {
                 const FEOSDevTestAccounts& TempAccount = Settings->TemporaryAccounts[TempIndex];
-                Credentials.Type = EOS_ELoginCredentialType::EOS_LCT_Developer;
-                Credentials.Id = TCHAR_TO_UTF8(*TempAccount.Host);
-                Credentials.Token = TCHAR_TO_UTF8(*TempAccount.Token);
+                LoginType = EOS_ELoginCredentialType::EOS_LCT_Developer;
+                LoginId = TempAccount.Host;
+                LoginToken = TempAccount.Token;
 
                 EM_LOG_INFO(TEXT("PIE Instance %d using DevAuthTool credentials (Host: %s, Token: %s)"),
                     PIEInstance, *TempAccount.Host, *TempAccount.Token);
@@ -194,9 +205,7 @@ void UEOSManager::AuthenticateUser()
             else
             {
                 // Fallback: Epic Account login
-                Credentials.Type = EOS_ELoginCredentialType::EOS_LCT_AccountPortal;
-                Credentials.Id = nullptr;
-                Credentials.Token = nullptr;
+                LoginType = EOS_ELoginCredentialType::EOS_LCT_AccountPortal;
 
                 EM_LOG_ERROR(TEXT("PIE Instance %d has no temporary account configured. Using Epic Account login."), PIEInstance);
             }
@@ -206,19 +215,32 @@ void UEOSManager::AuthenticateUser()
     else
     {
         // Normal editor = Epic Account
-        Credentials.Type = EOS_ELoginCredentialType::EOS_LCT_AccountPortal;
-        Credentials.Id = nullptr;
-        Credentials.Token = nullptr;
+        LoginType = EOS_ELoginCredentialType::EOS_LCT_AccountPortal;
 
         EM_LOG_INFO(TEXT("Editor mode using Epic Account auth"));
     }
 
-    EOS_Auth_LoginOptions LoginOptions = {};
-    LoginOptions.ApiVersion = EOS_AUTH_LOGIN_API_LATEST;
-    LoginOptions.Credentials = &Credentials;
-
     EM_LOG_INFO(TEXT("Starting Epic Account authentication..."));
-    EOS_Auth_Login(AuthHandle, &LoginOptions, this, OnAuthLoginComplete);
+    EOSOperationRunner::Run(EOSOperations::AuthLogin, CircuitBreaker, this, this,
+        [AuthHandle, LoginType, LoginId, LoginToken](void* OperationData, EOS_Auth_OnLoginCallback Callback)
+        {
+            FTCHARToUTF8 IdConverter(*LoginId);
+            FTCHARToUTF8 TokenConverter(*LoginToken);
+
+            EOS_Auth_Credentials Credentials = {};
+            Credentials.ApiVersion = EOS_AUTH_CREDENTIALS_API_LATEST;
+            Credentials.Type = LoginType;
+            Credentials.Id = LoginId.IsEmpty() ? nullptr : IdConverter.Get();
+            Credentials.Token = LoginToken.IsEmpty() ? nullptr : TokenConverter.Get();
+
+            EOS_Auth_LoginOptions LoginOptions = {};
+            LoginOptions.ApiVersion = EOS_AUTH_LOGIN_API_LATEST;
+            LoginOptions.Credentials = &Credentials;
+
+            EOS_Auth_Login(AuthHandle, &LoginOptions, OperationData, Callback);
+            return true;
+        },
+        OnAuthLoginComplete);
 }
 
 void UEOSManager::OnAuthLoginComplete(const EOS_Auth_LoginCallbackInfo* Data)
@@ -245,21 +267,29 @@ void UEOSManager::OnAuthLoginComplete(const EOS_Auth_LoginCallbackInfo* Data)
         {
             EOS_HConnect ConnectHandle = EOS_Platform_GetConnectInterface(PlatformHandle);
 
-            EOS_Connect_Credentials ConnectCredentials = {};
-            ConnectCredentials.ApiVersion = EOS_CONNECT_CREDENTIALS_API_LATEST;
-            ConnectCredentials.Type = EOS_EExternalCredentialType::EOS_ECT_EPIC;
-            ConnectCredentials.Token = AuthToken->AccessToken;
-
-            EOS_Connect_LoginOptions ConnectLoginOptions = {};
-            ConnectLoginOptions.ApiVersion = EOS_CONNECT_LOGIN_API_LATEST;
-            ConnectLoginOptions.Credentials = &ConnectCredentials;
-            ConnectLoginOptions.UserLoginInfo = nullptr;
-
             // Store the token for potential user creation
             Manager->StoredAuthToken = FString(AuthToken->AccessToken);
 
             EM_LOG_INFO(TEXT("Attempting Connect login..."));
-            EOS_Connect_Login(ConnectHandle, &ConnectLoginOptions, Manager, OnConnectLoginFromEpicComplete);
+            EOSOperationRunner::Run(EOSOperations::ConnectLogin, Manager->CircuitBreaker, Manager, Manager,
+                [ConnectHandle, AccessToken = Manager->StoredAuthToken](void* OperationData, EOS_Connect_OnLoginCallback Callback)
+                {
+                    FTCHARToUTF8 TokenConverter(*AccessToken);
+
+                    EOS_Connect_Credentials ConnectCredentials = {};
+                    ConnectCredentials.ApiVersion = EOS_CONNECT_CREDENTIALS_API_LATEST;
+                    ConnectCredentials.Type = EOS_EExternalCredentialType::EOS_ECT_EPIC;
+                    ConnectCredentials.Token = TokenConverter.Get();
+
+                    EOS_Connect_LoginOptions ConnectLoginOptions = {};
+                    ConnectLoginOptions.ApiVersion = EOS_CONNECT_LOGIN_API_LATEST;
+                    ConnectLoginOptions.Credentials = &ConnectCredentials;
+                    ConnectLoginOptions.UserLoginInfo = nullptr;
+
+                    EOS_Connect_Login(ConnectHandle, &ConnectLoginOptions, OperationData, Callback);
+                    return true;
+                },
+                OnConnectLoginFromEpicComplete);
 
             EOS_Auth_Token_Release(AuthToken);
         }
@@ -302,11 +332,17 @@ void UEOSManager::OnConnectLoginFromEpicComplete(const EOS_Connect_LoginCallback
         EOS_HPlatform PlatformHandle = *Platforms[0];
         EOS_HConnect ConnectHandle = EOS_Platform_GetConnectInterface(PlatformHandle);
 
-        EOS_Connect_CreateUserOptions CreateOptions = {};
-        CreateOptions.ApiVersion = EOS_CONNECT_CREATEUSER_API_LATEST;
-        CreateOptions.ContinuanceToken = Data->ContinuanceToken;
-
-        EOS_Connect_CreateUser(ConnectHandle, &CreateOptions, Manager, OnCreateUserComplete);
+        EOSOperationRunner::Run(EOSOperations::CreateUser, Manager->CircuitBreaker, Manager, Manager,
+            [ConnectHandle, ContinuanceToken = Data->ContinuanceToken](void* OperationData, EOS_Connect_OnCreateUserCallback Callback)
+            {
+                EOS_Connect_CreateUserOptions CreateOptions = {};
+                CreateOptions.ApiVersion = EOS_CONNECT_CREATEUSER_API_LATEST;
+                CreateOptions.ContinuanceToken = ContinuanceToken;
+
+                EOS_Connect_CreateUser(ConnectHandle, &CreateOptions, OperationData, Callback);
+                return true;
+            },
+            OnCreateUserComplete);
     }
     else
     {
@@ -365,6 +401,35 @@ void UEOSManager::InitializeManagers()
 
         SessionManager->Init(PlatformHandle, SessionHandle, LocalUserId, this);
 	}
+
+    // Quick match and session search need them, so measure once we're logged in
+    MeasureRegionLatencies();
+}
+
+void UEOSManager::MeasureRegionLatencies()
+{
+    const UEasyMatchmakingSettings* Settings = UEasyMatchmakingSettings::Get();
+    if (!Settings || Settings->Regions.Num() == 0)
+    {
+        return;
+    }
+
+    if (!RegionProbe.IsValid())
+    {
+        RegionProbe = MakeShared<FRegionLatencyProbe>();
+    }
+
+    TWeakObjectPtr<UEOSManager> WeakThis(this);
+    RegionProbe->Start(Settings->Regions, Settings->RegionPingCount, Settings->RegionPingTimeout,
+        FOnRegionLatenciesMeasured::CreateLambda([WeakThis](const TMap<FString, int32>& Latencies)
+        {
+            if (UEOSManager* Manager = WeakThis.Get())
+            {
+                Manager->RegionLatencies = Latencies;
+                EM_LOG_INFO(TEXT("Region latencies measured, best region: %s"), *Manager->GetBestRegion());
+                Manager->OnRegionLatenciesUpdated.Broadcast(Manager->GetBestRegion());
+            }
+        }));
 }
 
 EOS_HPlatform UEOSManager::GetPlatformHandle()
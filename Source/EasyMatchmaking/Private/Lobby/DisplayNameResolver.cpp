@@ -0,0 +1,399 @@
+#include "Lobby/DisplayNameResolver.h"
+
+#include <eos_connect.h>
+#include <eos_sdk.h>
+#include <eos_userinfo.h>
+
+#include "Async/Async.h"
+#include "Async/EOSOperationRunner.h"
+#include "EasyMatchmakingLog.h"
+#include "EasyMatchmakingSettings.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+    constexpr double FailedLookupRetrySeconds = 60.0;
+
+    // Bump when the file layout changes, older files are ignored
+    constexpr int32 CacheFileMagic = 0x454D444E; // "EMDN"
+    constexpr int32 CacheFileVersion = 1;
+
+    FString ProductUserIdToString(EOS_ProductUserId UserId)
+    {
+        char UserIdStr[EOS_PRODUCTUSERID_MAX_LENGTH + 1];
+        int32_t BufferSize = sizeof(UserIdStr);
+        if (UserId && EOS_ProductUserId_ToString(UserId, UserIdStr, &BufferSize) == EOS_EResult::EOS_Success)
+        {
+            return FString(UTF8_TO_TCHAR(UserIdStr));
+        }
+
+        return FString();
+    }
+
+    FString EpicAccountIdToString(EOS_EpicAccountId AccountId)
+    {
+        char AccountIdStr[EOS_EPICACCOUNTID_MAX_LENGTH + 1];
+        int32_t BufferSize = sizeof(AccountIdStr);
+        if (AccountId && EOS_EpicAccountId_ToString(AccountId, AccountIdStr, &BufferSize) == EOS_EResult::EOS_Success)
+        {
+            return FString(UTF8_TO_TCHAR(AccountIdStr));
+        }
+
+        return FString();
+    }
+}
+
+void FDisplayNameResolver::Init(EOS_HPlatform InPlatformHandle, EOS_ProductUserId InLocalUserId, EOS_EpicAccountId InLocalEpicAccountId,
+    const TSharedRef<FEOSCircuitBreaker>& InCircuitBreaker)
+{
+    PlatformHandle = InPlatformHandle;
+    LocalUserId = InLocalUserId;
+    LocalEpicAccountId = InLocalEpicAccountId;
+    CircuitBreaker = InCircuitBreaker;
+}
+
+bool FDisplayNameResolver::Request(EOS_ProductUserId UserId)
+{
+    if (!UserId || InFlight.Contains(UserId) || Queued.Contains(UserId))
+    {
+        return false;
+    }
+
+    // Known names are only looked up again once they expired
+    if (const FResolvedDisplayName* Known = Resolved.Find(UserId))
+    {
+        const FTimespan TTL = FTimespan::FromHours(UEasyMatchmakingSettings::Get()->DisplayNameCacheTTLHours);
+        if (FDateTime::UtcNow() - Known->VerifiedAt < TTL)
+        {
+            return false;
+        }
+    }
+
+    if (const double* FailedTime = FailedAt.Find(UserId))
+    {
+        if (FPlatformTime::Seconds() - *FailedTime < FailedLookupRetrySeconds)
+        {
+            return false;
+        }
+        FailedAt.Remove(UserId);
+    }
+
+    Queued.Add(UserId);
+    return true;
+}
+
+void FDisplayNameResolver::Flush()
+{
+    if (Queued.Num() == 0 || !PlatformHandle || !LocalUserId || !CircuitBreaker.IsValid())
+    {
+        return;
+    }
+
+    EOS_HConnect ConnectHandle = EOS_Platform_GetConnectInterface(PlatformHandle);
+
+    // One mappings query per batch, split only if we go over what EOS takes in one call
+    for (int32 Start = 0; Start < Queued.Num(); Start += EOS_CONNECT_QUERYPRODUCTUSERIDMAPPINGS_MAX_ACCOUNT_IDS)
+    {
+        const int32 Count = FMath::Min<int32>(Queued.Num() - Start, EOS_CONNECT_QUERYPRODUCTUSERIDMAPPINGS_MAX_ACCOUNT_IDS);
+
+        FBatch* Batch = new FBatch;
+        Batch->Resolver = AsShared();
+        Batch->UserIds.Append(Queued.GetData() + Start, Count);
+
+        for (EOS_ProductUserId UserId : Batch->UserIds)
+        {
+            InFlight.Add(UserId);
+        }
+
+        EM_LOG_INFO(TEXT("Querying ProductUserId mappings for %d display names"), Count);
+        EOSOperationRunner::Run(EOSOperations::QueryUserIdMappings, CircuitBreaker.ToSharedRef(), Batch, nullptr,
+            [Batch, ConnectHandle](void* OperationData, EOS_Connect_OnQueryProductUserIdMappingsCallback Callback)
+            {
+                TSharedPtr<FDisplayNameResolver> Resolver = Batch->Resolver.Pin();
+                if (!Resolver.IsValid())
+                {
+                    return false;
+                }
+
+                EOS_Connect_QueryProductUserIdMappingsOptions QueryOptions = {};
+                QueryOptions.ApiVersion = EOS_CONNECT_QUERYPRODUCTUSERIDMAPPINGS_API_LATEST;
+                QueryOptions.LocalUserId = Resolver->LocalUserId;
+                QueryOptions.ProductUserIds = Batch->UserIds.GetData();
+                QueryOptions.ProductUserIdCount = Batch->UserIds.Num();
+
+                EOS_Connect_QueryProductUserIdMappings(ConnectHandle, &QueryOptions, OperationData, Callback);
+                return true;
+            },
+            OnQueryMappingsComplete);
+    }
+
+    Queued.Reset();
+}
+
+void FDisplayNameResolver::OnQueryMappingsComplete(const EOS_Connect_QueryProductUserIdMappingsCallbackInfo* Data)
+{
+    FBatch* Batch = static_cast<FBatch*>(Data->ClientData);
+    TSharedPtr<FDisplayNameResolver> Resolver = Batch->Resolver.Pin();
+    if (!Resolver.IsValid())
+    {
+        delete Batch;
+        return;
+    }
+
+    if (Data->ResultCode != EOS_EResult::EOS_Success)
+    {
+        EM_LOG_ERROR(TEXT("Failed to query ProductUserId mappings: %s"), UTF8_TO_TCHAR(EOS_EResult_ToString(Data->ResultCode)));
+        FinishBatch(Batch);
+        return;
+    }
+
+    EOS_HConnect ConnectHandle = EOS_Platform_GetConnectInterface(Resolver->PlatformHandle);
+    for (EOS_ProductUserId UserId : Batch->UserIds)
+    {
+        EOS_Connect_GetProductUserIdMappingOptions GetMappingOptions = {};
+        GetMappingOptions.ApiVersion = EOS_CONNECT_GETPRODUCTUSERIDMAPPING_API_LATEST;
+        GetMappingOptions.LocalUserId = Resolver->LocalUserId;
+        GetMappingOptions.TargetProductUserId = UserId;
+        GetMappingOptions.AccountIdType = EOS_EExternalAccountType::EOS_EAT_EPIC;
+
+        char ExternalAccountId[EOS_CONNECT_EXTERNAL_ACCOUNT_ID_MAX_LENGTH + 1];
+        int32_t BufferSize = sizeof(ExternalAccountId);
+
+        if (EOS_Connect_GetProductUserIdMapping(ConnectHandle, &GetMappingOptions, ExternalAccountId, &BufferSize) != EOS_EResult::EOS_Success)
+        {
+            EM_LOG_INFO(TEXT("No Epic account mapping found for ProductUserId"));
+            continue;
+        }
+
+        FResolvedDisplayName& Pending = Batch->PendingUserInfo.Add(UTF8_TO_TCHAR(ExternalAccountId));
+        Pending.UserId = UserId;
+        Pending.EpicAccountId = EOS_EpicAccountId_FromString(ExternalAccountId);
+        Pending.EpicAccountIdString = UTF8_TO_TCHAR(ExternalAccountId);
+    }
+
+    if (Batch->PendingUserInfo.Num() == 0)
+    {
+        FinishBatch(Batch);
+        return;
+    }
+
+    // Count first, the callbacks must not see a partial number
+    Batch->PendingQueries = Batch->PendingUserInfo.Num();
+
+    EOS_HUserInfo UserInfoHandle = EOS_Platform_GetUserInfoInterface(Resolver->PlatformHandle);
+    for (const TPair<FString, FResolvedDisplayName>& Pair : Batch->PendingUserInfo)
+    {
+        EOSOperationRunner::Run(EOSOperations::QueryUserInfo, Resolver->CircuitBreaker.ToSharedRef(), Batch, nullptr,
+            [Batch, UserInfoHandle, TargetUserId = Pair.Value.EpicAccountId](void* OperationData, EOS_UserInfo_OnQueryUserInfoCallback Callback)
+            {
+                TSharedPtr<FDisplayNameResolver> Resolver = Batch->Resolver.Pin();
+                if (!Resolver.IsValid())
+                {
+                    return false;
+                }
+
+                EOS_UserInfo_QueryUserInfoOptions UserInfoQueryOptions = {};
+                UserInfoQueryOptions.ApiVersion = EOS_USERINFO_QUERYUSERINFO_API_LATEST;
+                UserInfoQueryOptions.LocalUserId = Resolver->LocalEpicAccountId;
+                UserInfoQueryOptions.TargetUserId = TargetUserId;
+
+                EOS_UserInfo_QueryUserInfo(UserInfoHandle, &UserInfoQueryOptions, OperationData, Callback);
+                return true;
+            },
+            OnQueryUserInfoComplete);
+    }
+}
+
+void FDisplayNameResolver::OnQueryUserInfoComplete(const EOS_UserInfo_QueryUserInfoCallbackInfo* Data)
+{
+    FBatch* Batch = static_cast<FBatch*>(Data->ClientData);
+    TSharedPtr<FDisplayNameResolver> Resolver = Batch->Resolver.Pin();
+
+    if (Resolver.IsValid() && Data->ResultCode == EOS_EResult::EOS_Success)
+    {
+        EOS_HUserInfo UserInfoHandle = EOS_Platform_GetUserInfoInterface(Resolver->PlatformHandle);
+
+        EOS_UserInfo_CopyUserInfoOptions CopyOptions = {};
+        CopyOptions.ApiVersion = EOS_USERINFO_COPYUSERINFO_API_LATEST;
+        CopyOptions.LocalUserId = Resolver->LocalEpicAccountId;
+        CopyOptions.TargetUserId = Data->TargetUserId;
+
+        EOS_UserInfo* UserInfo = nullptr;
+        EOS_EResult CopyResult = EOS_UserInfo_CopyUserInfo(UserInfoHandle, &CopyOptions, &UserInfo);
+
+        const FResolvedDisplayName* Pending = Batch->PendingUserInfo.Find(EpicAccountIdToString(Data->TargetUserId));
+        if (CopyResult == EOS_EResult::EOS_Success && UserInfo && Pending)
+        {
+            FResolvedDisplayName& Result = Batch->Results.Add_GetRef(*Pending);
+            Result.DisplayName = UTF8_TO_TCHAR(UserInfo->DisplayName ? UserInfo->DisplayName : "");
+            Result.VerifiedAt = FDateTime::UtcNow();
+        }
+        else
+        {
+            EM_LOG_ERROR(TEXT("Failed to copy user info: %s"),
+                UTF8_TO_TCHAR(EOS_EResult_ToString(CopyResult)));
+        }
+
+        if (UserInfo)
+        {
+            EOS_UserInfo_Release(UserInfo);
+        }
+    }
+    else if (Data->ResultCode != EOS_EResult::EOS_Success)
+    {
+        EM_LOG_ERROR(TEXT("Failed to query user info: %s"), UTF8_TO_TCHAR(EOS_EResult_ToString(Data->ResultCode)));
+    }
+
+    if (--Batch->PendingQueries <= 0)
+    {
+        FinishBatch(Batch);
+    }
+}
+
+void FDisplayNameResolver::FinishBatch(FBatch* Batch)
+{
+    TSharedPtr<FDisplayNameResolver> Resolver = Batch->Resolver.Pin();
+    if (Resolver.IsValid())
+    {
+        for (const FResolvedDisplayName& Result : Batch->Results)
+        {
+            Resolver->Resolved.Add(Result.UserId, Result);
+        }
+
+        // Stale cached names that failed to revalidate keep their old value, but are not asked again right away either
+        const double Now = FPlatformTime::Seconds();
+        for (EOS_ProductUserId UserId : Batch->UserIds)
+        {
+            Resolver->InFlight.Remove(UserId);
+            if (!Batch->Results.ContainsByPredicate([UserId](const FResolvedDisplayName& Result) { return Result.UserId == UserId; }))
+            {
+                Resolver->FailedAt.Add(UserId, Now);
+            }
+        }
+
+        EM_LOG_INFO(TEXT("Resolved %d of %d display names"), Batch->Results.Num(), Batch->UserIds.Num());
+        if (Batch->Results.Num() > 0)
+        {
+            Resolver->SaveCache();
+            Resolver->OnResolved.ExecuteIfBound(Batch->Results);
+        }
+    }
+
+    delete Batch;
+}
+
+FString FDisplayNameResolver::GetCachePath()
+{
+    return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("EasyMatchmaking"), TEXT("DisplayNameCache.bin"));
+}
+
+void FDisplayNameResolver::LoadCache()
+{
+    TArray<uint8> FileData;
+    if (!FFileHelper::LoadFileToArray(FileData, *GetCachePath(), FILEREAD_Silent))
+    {
+        return;
+    }
+
+    FMemoryReader Reader(FileData);
+    int32 Magic = 0;
+    int32 Version = 0;
+    int32 NumEntries = 0;
+    Reader << Magic << Version << NumEntries;
+
+    if (Magic != CacheFileMagic || Version != CacheFileVersion || NumEntries < 0)
+    {
+        EM_LOG_WARNING(TEXT("Ignoring display name cache with unknown format"));
+        return;
+    }
+
+    for (int32 i = 0; i < NumEntries && !Reader.IsError(); i++)
+    {
+        FString UserIdString;
+        FString EpicAccountIdString;
+        FString DisplayName;
+        int64 VerifiedTicks = 0;
+        Reader << UserIdString << EpicAccountIdString << DisplayName << VerifiedTicks;
+
+        EOS_ProductUserId UserId = EOS_ProductUserId_FromString(TCHAR_TO_UTF8(*UserIdString));
+        if (Reader.IsError() || !UserId || Resolved.Contains(UserId))
+        {
+            continue;
+        }
+
+        FResolvedDisplayName& Entry = Resolved.Add(UserId);
+        Entry.UserId = UserId;
+        Entry.EpicAccountId = EOS_EpicAccountId_FromString(TCHAR_TO_UTF8(*EpicAccountIdString));
+        Entry.EpicAccountIdString = EpicAccountIdString;
+        Entry.DisplayName = DisplayName;
+        Entry.VerifiedAt = FDateTime(VerifiedTicks);
+    }
+
+    // Revalidate the expired ones in the background, they are shown with the old name until the answer arrives
+    for (const TPair<EOS_ProductUserId, FResolvedDisplayName>& Pair : Resolved)
+    {
+        Request(Pair.Key);
+    }
+
+    EM_LOG_INFO(TEXT("Loaded %d cached display names, %d to revalidate"), Resolved.Num(), Queued.Num());
+}
+
+void FDisplayNameResolver::SaveCache()
+{
+    // Only the file is trimmed, names of players we still see stay resolved in memory
+    TArray<const FResolvedDisplayName*> Entries;
+    Entries.Reserve(Resolved.Num());
+    for (const TPair<EOS_ProductUserId, FResolvedDisplayName>& Pair : Resolved)
+    {
+        Entries.Add(&Pair.Value);
+    }
+
+    // Keep the most recently verified names
+    const int32 MaxEntries = FMath::Max(0, UEasyMatchmakingSettings::Get()->DisplayNameCacheMaxEntries);
+    if (Entries.Num() > MaxEntries)
+    {
+        Entries.Sort([](const FResolvedDisplayName& A, const FResolvedDisplayName& B) { return A.VerifiedAt > B.VerifiedAt; });
+        Entries.SetNum(MaxEntries);
+    }
+
+    TArray<uint8> FileData;
+    FMemoryWriter Writer(FileData);
+
+    int32 Magic = CacheFileMagic;
+    int32 Version = CacheFileVersion;
+    int32 NumEntries = Entries.Num();
+    Writer << Magic << Version << NumEntries;
+
+    for (const FResolvedDisplayName* Entry : Entries)
+    {
+        FString UserIdString = ProductUserIdToString(Entry->UserId);
+        FString EpicAccountIdString = Entry->EpicAccountIdString;
+        FString DisplayName = Entry->DisplayName;
+        int64 VerifiedTicks = Entry->VerifiedAt.GetTicks();
+        Writer << UserIdString << EpicAccountIdString << DisplayName << VerifiedTicks;
+    }
+
+    Async(EAsyncExecution::ThreadPool, [FileData = MoveTemp(FileData), State = CacheWriter, Sequence = ++SaveSequence]()
+    {
+        FScopeLock ScopeLock(&State->Lock);
+
+        // A newer snapshot got here first
+        if (Sequence <= State->WrittenSequence)
+        {
+            return;
+        }
+        State->WrittenSequence = Sequence;
+
+        // Write next to the cache and move over it, so a crash mid-write never leaves a broken file
+        const FString CachePath = GetCachePath();
+        const FString TempPath = CachePath + TEXT(".tmp");
+        if (!FFileHelper::SaveArrayToFile(FileData, *TempPath) || !IFileManager::Get().Move(*CachePath, *TempPath, true, true))
+        {
+            EM_LOG_WARNING(TEXT("Failed to write display name cache to %s"), *CachePath);
+        }
+    });
+}
@@ -0,0 +1,177 @@
+#include "Lobby/LobbyAttributes.h"
+
+#include "EasyMatchmakingLog.h"
+
+FLobbyAttributeValue FLobbyAttributeValue::MakeBool(bool bValue)
+{
+    FLobbyAttributeValue Value;
+    Value.Type = ELobbyAttributeType::Bool;
+    Value.BoolValue = bValue;
+    return Value;
+}
+
+FLobbyAttributeValue FLobbyAttributeValue::MakeInt64(int64 InValue)
+{
+    FLobbyAttributeValue Value;
+    Value.Type = ELobbyAttributeType::Int64;
+    Value.Int64Value = InValue;
+    return Value;
+}
+
+FLobbyAttributeValue FLobbyAttributeValue::MakeDouble(double InValue)
+{
+    FLobbyAttributeValue Value;
+    Value.Type = ELobbyAttributeType::Double;
+    Value.DoubleValue = InValue;
+    return Value;
+}
+
+FLobbyAttributeValue FLobbyAttributeValue::MakeString(const FString& InValue)
+{
+    FLobbyAttributeValue Value;
+    Value.Type = ELobbyAttributeType::String;
+    Value.StringValue = InValue;
+    return Value;
+}
+
+FLobbyAttributeValue FLobbyAttributeValue::FromEOS(const EOS_Lobby_AttributeData& Data)
+{
+    switch (Data.ValueType)
+    {
+    case EOS_ELobbyAttributeType::EOS_AT_BOOLEAN:
+        return MakeBool(Data.Value.AsBool == EOS_TRUE);
+    case EOS_ELobbyAttributeType::EOS_AT_INT64:
+        return MakeInt64(static_cast<int64>(Data.Value.AsInt64));
+    case EOS_ELobbyAttributeType::EOS_AT_DOUBLE:
+        return MakeDouble(Data.Value.AsDouble);
+    case EOS_ELobbyAttributeType::EOS_AT_STRING:
+        return MakeString(Data.Value.AsUtf8 ? FString(UTF8_TO_TCHAR(Data.Value.AsUtf8)) : FString());
+    }
+
+    return FLobbyAttributeValue();
+}
+
+void FLobbyAttributeValue::ToEOS(EOS_Lobby_AttributeData& OutData, const char* Key, TArray<ANSICHAR>& StringStorage) const
+{
+    OutData = {};
+    OutData.ApiVersion = EOS_LOBBY_ATTRIBUTEDATA_API_LATEST;
+    OutData.Key = Key;
+
+    switch (Type)
+    {
+    case ELobbyAttributeType::Bool:
+        OutData.ValueType = EOS_ELobbyAttributeType::EOS_AT_BOOLEAN;
+        OutData.Value.AsBool = BoolValue ? EOS_TRUE : EOS_FALSE;
+        break;
+    case ELobbyAttributeType::Int64:
+        OutData.ValueType = EOS_ELobbyAttributeType::EOS_AT_INT64;
+        OutData.Value.AsInt64 = Int64Value;
+        break;
+    case ELobbyAttributeType::Double:
+        OutData.ValueType = EOS_ELobbyAttributeType::EOS_AT_DOUBLE;
+        OutData.Value.AsDouble = DoubleValue;
+        break;
+    case ELobbyAttributeType::String:
+    case ELobbyAttributeType::None:
+    {
+        FTCHARToUTF8 Converter(*StringValue);
+        StringStorage.SetNumUninitialized(Converter.Length() + 1);
+        FMemory::Memcpy(StringStorage.GetData(), Converter.Get(), Converter.Length());
+        StringStorage[Converter.Length()] = '\0';
+
+        OutData.ValueType = EOS_ELobbyAttributeType::EOS_AT_STRING;
+        OutData.Value.AsUtf8 = StringStorage.GetData();
+        break;
+    }
+    }
+}
+
+FString FLobbyAttributeValue::ToString() const
+{
+    switch (Type)
+    {
+    case ELobbyAttributeType::Bool:
+        return BoolValue ? TEXT("true") : TEXT("false");
+    case ELobbyAttributeType::Int64:
+        return LexToString(Int64Value);
+    case ELobbyAttributeType::Double:
+        return LexToString(DoubleValue);
+    case ELobbyAttributeType::String:
+        return StringValue;
+    case ELobbyAttributeType::None:
+        break;
+    }
+
+    return FString();
+}
+
+bool FLobbyAttributeValue::operator==(const FLobbyAttributeValue& Other) const
+{
+    if (Type != Other.Type)
+    {
+        return false;
+    }
+
+    switch (Type)
+    {
+    case ELobbyAttributeType::Bool:
+        return BoolValue == Other.BoolValue;
+    case ELobbyAttributeType::Int64:
+        return Int64Value == Other.Int64Value;
+    case ELobbyAttributeType::Double:
+        return DoubleValue == Other.DoubleValue;
+    case ELobbyAttributeType::String:
+        return StringValue.Equals(Other.StringValue, ESearchCase::CaseSensitive);
+    case ELobbyAttributeType::None:
+        break;
+    }
+
+    return true;
+}
+
+FLobbyAttributeSchema::FLobbyAttributeSchema()
+{
+    // Built-in keys always take the first slots
+    verify(Declare(ELobbyAttributeScope::Lobby, LobbyAttributeKeys::SessionAddress, ELobbyAttributeType::String) == SessionAddressSlot);
+    verify(Declare(ELobbyAttributeScope::Lobby, LobbyAttributeKeys::Summary, ELobbyAttributeType::String) == SummarySlot);
+    verify(Declare(ELobbyAttributeScope::Lobby, LobbyAttributeKeys::Rating, ELobbyAttributeType::Double) == LobbyRatingSlot);
+    verify(Declare(ELobbyAttributeScope::Lobby, LobbyAttributeKeys::Region, ELobbyAttributeType::String) == LobbyRegionSlot);
+    verify(Declare(ELobbyAttributeScope::Lobby, LobbyAttributeKeys::SessionServer, ELobbyAttributeType::String) == SessionServerSlot);
+    verify(Declare(ELobbyAttributeScope::Member, LobbyAttributeKeys::Ready, ELobbyAttributeType::Bool) == ReadySlot);
+    verify(Declare(ELobbyAttributeScope::Member, LobbyAttributeKeys::Rating, ELobbyAttributeType::Double) == MemberRatingSlot);
+    verify(Declare(ELobbyAttributeScope::Member, LobbyAttributeKeys::JoinedSession, ELobbyAttributeType::String) == JoinedSessionSlot);
+}
+
+int32 FLobbyAttributeSchema::Declare(ELobbyAttributeScope Scope, const FString& Key, ELobbyAttributeType Type)
+{
+    TArray<FKey>& Keys = Scope == ELobbyAttributeScope::Lobby ? LobbyKeys : MemberKeys;
+    TMap<FString, int32>& SlotByKey = Scope == ELobbyAttributeScope::Lobby ? LobbySlotByKey : MemberSlotByKey;
+
+    if (const int32* ExistingSlot = SlotByKey.Find(Key))
+    {
+        if (Keys[*ExistingSlot].Type != Type)
+        {
+            EM_LOG_WARNING(TEXT("Lobby attribute '%s' was already declared with another type"), *Key);
+        }
+        return *ExistingSlot;
+    }
+
+    const int32 Slot = Keys.AddDefaulted();
+    FKey& NewKey = Keys[Slot];
+    NewKey.Key = Key;
+    NewKey.Type = Type;
+
+    FTCHARToUTF8 Converter(*Key);
+    NewKey.Utf8Key.Append(Converter.Get(), Converter.Length());
+    NewKey.Utf8Key.Add('\0');
+
+    SlotByKey.Add(Key, Slot);
+    return Slot;
+}
+
+int32 FLobbyAttributeSchema::FindSlot(ELobbyAttributeScope Scope, const FString& Key) const
+{
+    const TMap<FString, int32>& SlotByKey = Scope == ELobbyAttributeScope::Lobby ? LobbySlotByKey : MemberSlotByKey;
+    const int32* Slot = SlotByKey.Find(Key);
+    return Slot ? *Slot : INDEX_NONE;
+}
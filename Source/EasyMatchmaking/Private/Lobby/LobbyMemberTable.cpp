@@ -0,0 +1,94 @@
+#include "Lobby/LobbyMemberTable.h"
+
+FLobbyMemberInfo* FLobbyMemberTable::Find(EOS_ProductUserId UserId)
+{
+    const int32* Index = IndexByUserId.Find(UserId);
+    return Index ? &Members[*Index] : nullptr;
+}
+
+const FLobbyMemberInfo* FLobbyMemberTable::Find(EOS_ProductUserId UserId) const
+{
+    const int32* Index = IndexByUserId.Find(UserId);
+    return Index ? &Members[*Index] : nullptr;
+}
+
+FLobbyMemberInfo& FLobbyMemberTable::FindOrAdd(EOS_ProductUserId UserId, const FString& UserIdString, bool* bOutAdded)
+{
+    if (const int32* Index = IndexByUserId.Find(UserId))
+    {
+        if (bOutAdded)
+        {
+            *bOutAdded = false;
+        }
+        return Members[*Index];
+    }
+
+    const int32 NewIndex = Members.AddDefaulted();
+    IndexByUserId.Add(UserId, NewIndex);
+
+    FLobbyMemberInfo& Member = Members[NewIndex];
+    Member.UserId = UserId;
+    Member.UserIdString = UserIdString;
+
+    if (bOutAdded)
+    {
+        *bOutAdded = true;
+    }
+    return Member;
+}
+
+bool FLobbyMemberTable::Remove(EOS_ProductUserId UserId)
+{
+    int32 Index = INDEX_NONE;
+    if (!IndexByUserId.RemoveAndCopyValue(UserId, Index))
+    {
+        return false;
+    }
+
+    if (Members[Index].bIsReady)
+    {
+        ReadyCount--;
+    }
+
+    Members.RemoveAt(Index);
+    RebuildIndex(Index);
+    return true;
+}
+
+void FLobbyMemberTable::SetReady(FLobbyMemberInfo& Member, bool bReady)
+{
+    if (Member.bIsReady != bReady)
+    {
+        Member.bIsReady = bReady;
+        ReadyCount += bReady ? 1 : -1;
+    }
+}
+
+void FLobbyMemberTable::Reset()
+{
+    Members.Reset();
+    IndexByUserId.Reset();
+    ReadyCount = 0;
+}
+
+void FLobbyMemberTable::RecountReady()
+{
+    ReadyCount = 0;
+    for (const FLobbyMemberInfo& Member : Members)
+    {
+        ReadyCount += Member.bIsReady ? 1 : 0;
+    }
+}
+
+void FLobbyMemberTable::RebuildIndex(int32 FromIndex)
+{
+    if (FromIndex == 0)
+    {
+        IndexByUserId.Reset();
+    }
+
+    for (int32 Index = FromIndex; Index < Members.Num(); Index++)
+    {
+        IndexByUserId.Add(Members[Index].UserId, Index);
+    }
+}
@@ -0,0 +1,64 @@
+#include "Lobby/LobbyModificationQueue.h"
+
+void FLobbyModificationQueue::Enqueue(ELobbyAttributeScope Scope, int32 Slot, const FLobbyAttributeValue& Value, FOnLobbyModificationComplete&& OnComplete)
+{
+    FWrite* Existing = PendingWrites.FindByPredicate([Scope, Slot](const FWrite& Write) { return Write.Scope == Scope && Write.Slot == Slot; });
+    if (Existing)
+    {
+        Existing->Value = Value;
+    }
+    else
+    {
+        FWrite& Write = PendingWrites.AddDefaulted_GetRef();
+        Write.Scope = Scope;
+        Write.Slot = Slot;
+        Write.Value = Value;
+    }
+
+    if (OnComplete)
+    {
+        PendingCallbacks.Add(MoveTemp(OnComplete));
+    }
+}
+
+bool FLobbyModificationQueue::BeginFlush(TArray<FWrite>& OutWrites)
+{
+    if (bInFlight || PendingWrites.Num() == 0)
+    {
+        return false;
+    }
+
+    OutWrites = MoveTemp(PendingWrites);
+    InFlightCallbacks = MoveTemp(PendingCallbacks);
+    PendingWrites.Reset();
+    PendingCallbacks.Reset();
+    bInFlight = true;
+    return true;
+}
+
+void FLobbyModificationQueue::CompleteFlush(EOS_EResult Result)
+{
+    // Callbacks may queue new writes, so take them out first
+    TArray<FOnLobbyModificationComplete> Callbacks = MoveTemp(InFlightCallbacks);
+    InFlightCallbacks.Reset();
+    bInFlight = false;
+
+    Fire(Callbacks, Result);
+}
+
+void FLobbyModificationQueue::CancelPending(EOS_EResult Result)
+{
+    TArray<FOnLobbyModificationComplete> Callbacks = MoveTemp(PendingCallbacks);
+    PendingCallbacks.Reset();
+    PendingWrites.Reset();
+
+    Fire(Callbacks, Result);
+}
+
+void FLobbyModificationQueue::Fire(TArray<FOnLobbyModificationComplete>& Callbacks, EOS_EResult Result)
+{
+    for (FOnLobbyModificationComplete& Callback : Callbacks)
+    {
+        Callback(Result);
+    }
+}
@@ -0,0 +1,158 @@
+#include "Lobby/LobbyQuickMatch.h"
+
+#include <eos_lobby.h>
+
+#include "Lobby/LobbyAttributes.h"
+
+float LobbyQuickMatch::ScoreFillRatio(const FLobbyInfo& Lobby)
+{
+    return Lobby.MaxPlayers > 0 ? static_cast<float>(Lobby.CurrentPlayers) / Lobby.MaxPlayers : 0.0f;
+}
+
+int32 LobbyQuickMatch::CountMatchingAttributes(EOS_HLobbyDetails LobbyDetails, const TMap<FString, FString>& WantedAttributes)
+{
+    if (!LobbyDetails)
+    {
+        return 0;
+    }
+
+    int32 Matches = 0;
+    for (const TPair<FString, FString>& Wanted : WantedAttributes)
+    {
+        FTCHARToUTF8 KeyConverter(*Wanted.Key);
+
+        EOS_LobbyDetails_CopyAttributeByKeyOptions AttrOptions = {};
+        AttrOptions.ApiVersion = EOS_LOBBYDETAILS_COPYATTRIBUTEBYKEY_API_LATEST;
+        AttrOptions.AttrKey = KeyConverter.Get();
+
+        EOS_Lobby_Attribute* Attribute = nullptr;
+        if (EOS_LobbyDetails_CopyAttributeByKey(LobbyDetails, &AttrOptions, &Attribute) == EOS_EResult::EOS_Success && Attribute)
+        {
+            if (Attribute->Data && FLobbyAttributeValue::FromEOS(*Attribute->Data).ToString() == Wanted.Value)
+            {
+                Matches++;
+            }
+            EOS_Lobby_Attribute_Release(Attribute);
+        }
+    }
+
+    return Matches;
+}
+
+bool LobbyQuickMatch::GetLobbyRating(EOS_HLobbyDetails LobbyDetails, double& OutRating)
+{
+    if (!LobbyDetails)
+    {
+        return false;
+    }
+
+    EOS_LobbyDetails_CopyAttributeByKeyOptions AttrOptions = {};
+    AttrOptions.ApiVersion = EOS_LOBBYDETAILS_COPYATTRIBUTEBYKEY_API_LATEST;
+    AttrOptions.AttrKey = LobbyAttributeKeys::RatingUtf8;
+
+    EOS_Lobby_Attribute* Attribute = nullptr;
+    if (EOS_LobbyDetails_CopyAttributeByKey(LobbyDetails, &AttrOptions, &Attribute) != EOS_EResult::EOS_Success || !Attribute)
+    {
+        return false;
+    }
+
+    const FLobbyAttributeValue Value = Attribute->Data ? FLobbyAttributeValue::FromEOS(*Attribute->Data) : FLobbyAttributeValue();
+    EOS_Lobby_Attribute_Release(Attribute);
+
+    if (Value.Type == ELobbyAttributeType::Double)
+    {
+        OutRating = Value.DoubleValue;
+        return true;
+    }
+    if (Value.Type == ELobbyAttributeType::Int64)
+    {
+        OutRating = static_cast<double>(Value.Int64Value);
+        return true;
+    }
+    return false;
+}
+
+float LobbyQuickMatch::ScoreSkill(EOS_HLobbyDetails LobbyDetails, double Rating, double Window)
+{
+    double LobbyRating = 0.0;
+    if (!GetLobbyRating(LobbyDetails, LobbyRating))
+    {
+        return -1.0f;
+    }
+
+    const double Distance = FMath::Abs(LobbyRating - Rating);
+    if (Distance > Window)
+    {
+        return -1.0f;
+    }
+    return Window > 0.0 ? static_cast<float>(1.0 - Distance / Window) : 1.0f;
+}
+
+float LobbyQuickMatch::ScoreLatency(int32 LatencyMs, int32 CapMs)
+{
+    if (LatencyMs < 0)
+    {
+        return 0.0f;
+    }
+
+    if (CapMs <= 0)
+    {
+        // No cap, still prefer the closer ones
+        return 1.0f / (1.0f + LatencyMs / 100.0f);
+    }
+
+    return LatencyMs > CapMs ? -1.0f : 1.0f - static_cast<float>(LatencyMs) / CapMs;
+}
+
+FLobbyScorer LobbyQuickMatch::MakeDefaultScorer(const TMap<FString, FString>& WantedAttributes, float AttributeWeight)
+{
+    return [WantedAttributes, AttributeWeight](const FLobbyInfo& Lobby, EOS_HLobbyDetails LobbyDetails)
+    {
+        return ScoreFillRatio(Lobby) + AttributeWeight * CountMatchingAttributes(LobbyDetails, WantedAttributes);
+    };
+}
+
+TArray<FQuickMatchCandidate> LobbyQuickMatch::RankCandidates(const FLobbySearch& Search, const FLobbyScorer& Scorer)
+{
+    TArray<FQuickMatchCandidate> Candidates;
+    Candidates.Reserve(Search.GetResultCount());
+
+    for (uint32 Index = 0; Index < Search.GetResultCount(); Index++)
+    {
+        EOS_HLobbyDetails LobbyDetails = Search.CopyResultDetails(Index);
+        if (!LobbyDetails)
+        {
+            continue;
+        }
+
+        FQuickMatchCandidate Candidate;
+        Candidate.Lobby = FLobbySearch::MakeLobbyInfo(LobbyDetails);
+        Candidate.LobbyDetails = LobbyDetails;
+        Candidate.Score = Scorer ? Scorer(Candidate.Lobby, LobbyDetails) : ScoreFillRatio(Candidate.Lobby);
+
+        if (Candidate.Lobby.LobbyId.IsEmpty() || Candidate.Lobby.CurrentPlayers >= Candidate.Lobby.MaxPlayers || Candidate.Score < 0.0f)
+        {
+            EOS_LobbyDetails_Release(LobbyDetails);
+            continue;
+        }
+
+        Candidates.Add(MoveTemp(Candidate));
+    }
+
+    // Stable, so equal scores keep the backend's order
+    Candidates.StableSort([](const FQuickMatchCandidate& A, const FQuickMatchCandidate& B) { return A.Score > B.Score; });
+    return Candidates;
+}
+
+void LobbyQuickMatch::ReleaseCandidates(TArray<FQuickMatchCandidate>& Candidates)
+{
+    for (FQuickMatchCandidate& Candidate : Candidates)
+    {
+        if (Candidate.LobbyDetails)
+        {
+            EOS_LobbyDetails_Release(Candidate.LobbyDetails);
+            Candidate.LobbyDetails = nullptr;
+        }
+    }
+    Candidates.Reset();
+}
@@ -0,0 +1,508 @@
+#include "Lobby/LobbySearch.h"
+
+#include <eos_lobby.h>
+
+#include "Async/EOSOperationRunner.h"
+#include "EasyMatchmakingLog.h"
+#include "Lobby/LobbySummary.h"
+
+namespace
+{
+    struct FFindContext
+    {
+        TWeakPtr<FLobbySearch> Search;
+    };
+}
+
+FLobbySearchFilter FLobbySearchFilter::Make(const FString& Key, const FLobbyAttributeValue& Value, ELobbySearchComparison Comparison)
+{
+    FLobbySearchFilter Filter;
+    Filter.Key = Key;
+    Filter.Value = Value;
+    Filter.Comparison = Comparison;
+    return Filter;
+}
+
+FLobbySearchFilter FLobbySearchFilter::MakeRange(const FString& Key, const FLobbyAttributeValue& Min, const FLobbyAttributeValue& Max)
+{
+    FLobbySearchFilter Filter = Make(Key, Min, ELobbySearchComparison::Range);
+    Filter.MaxValue = Max;
+    return Filter;
+}
+
+FString FLobbySearchFilter::ToString() const
+{
+    static const TCHAR* ComparisonNames[] = { TEXT("=="), TEXT("!="), TEXT(">"), TEXT(">="), TEXT("<"), TEXT("<="), TEXT("in"), TEXT("has"), TEXT("any") };
+
+    FString Result = FString::Printf(TEXT("%s%s%d:%s"), *Key, ComparisonNames[static_cast<uint8>(Comparison)],
+        static_cast<int32>(Value.Type), *Value.ToString());
+    if (Comparison == ELobbySearchComparison::Range)
+    {
+        Result += FString::Printf(TEXT("..%d:%s"), static_cast<int32>(MaxValue.Type), *MaxValue.ToString());
+    }
+    return Result;
+}
+
+FString FLobbySearchParams::MakeKey() const
+{
+    if (!LobbyId.IsEmpty())
+    {
+        return FString::Printf(TEXT("id=%s"), *LobbyId);
+    }
+
+    FString Key = FString::Printf(TEXT("bucket=%s;max=%d;slots=%d"), *BucketId, MaxResults, MinAvailableSlots);
+    for (const FLobbySearchFilter& Filter : Filters)
+    {
+        Key += TEXT(";");
+        Key += Filter.ToString();
+    }
+    return Key;
+}
+
+FLobbySearch::FLobbySearch(int32 InRequestId, const FLobbySearchParams& InParams)
+    : RequestId(InRequestId)
+    , Params(InParams)
+    , Key(InParams.MakeKey())
+{
+}
+
+FLobbySearch::~FLobbySearch()
+{
+    Cancel();
+}
+
+bool FLobbySearch::Start(EOS_HLobby LobbyHandle, EOS_ProductUserId LocalUserId, const TSharedRef<FEOSCircuitBreaker>& CircuitBreaker, int32 InPageSize, float InFrameBudgetMs)
+{
+    PageSize = FMath::Max(1, InPageSize);
+    FrameBudgetSeconds = FMath::Max(0.0f, InFrameBudgetMs) / 1000.0;
+
+    // Create lobby search handle
+    EOS_Lobby_CreateLobbySearchOptions SearchOptions = {};
+    SearchOptions.ApiVersion = EOS_LOBBY_CREATELOBBYSEARCH_API_LATEST;
+    SearchOptions.MaxResults = Params.LobbyId.IsEmpty() ? FMath::Clamp(Params.MaxResults, 1, EOS_LOBBY_MAX_SEARCH_RESULTS) : 1;
+
+    EOS_EResult Result = EOS_Lobby_CreateLobbySearch(LobbyHandle, &SearchOptions, &SearchHandle);
+    if (Result != EOS_EResult::EOS_Success || !SearchHandle)
+    {
+        EM_LOG_ERROR(TEXT("Failed to create lobby search: %s"), UTF8_TO_TCHAR(EOS_EResult_ToString(Result)));
+        return false;
+    }
+
+    if (!ApplyParams())
+    {
+        EOS_LobbySearch_Release(SearchHandle);
+        SearchHandle = nullptr;
+        return false;
+    }
+
+    FFindContext* Context = new FFindContext;
+    Context->Search = AsShared();
+
+    // Execute search
+    EM_LOG_INFO(TEXT("Executing lobby search %d (%s)..."), RequestId, *Key);
+    EOSOperationRunner::Run(EOSOperations::FindLobbies, CircuitBreaker, Context, nullptr,
+        [Context, LocalUserId](void* OperationData, EOS_LobbySearch_OnFindCallback Callback)
+        {
+            // A retry only goes out while the search still wants it
+            TSharedPtr<FLobbySearch> Search = Context->Search.Pin();
+            if (!Search.IsValid() || !Search->SearchHandle)
+            {
+                return false;
+            }
+
+            EOS_LobbySearch_FindOptions FindOptions = {};
+            FindOptions.ApiVersion = EOS_LOBBYSEARCH_FIND_API_LATEST;
+            FindOptions.LocalUserId = LocalUserId;
+
+            EOS_LobbySearch_Find(Search->SearchHandle, &FindOptions, OperationData, Callback);
+            return true;
+        },
+        OnFindComplete);
+    return true;
+}
+
+bool FLobbySearch::SetParameter(const char* AttrKey, const FLobbyAttributeValue& Value, EOS_EComparisonOp ComparisonOp)
+{
+    // SetParameter copies the data, the storage only has to outlive the call
+    TArray<ANSICHAR> StringStorage;
+    EOS_Lobby_AttributeData Parameter;
+    Value.ToEOS(Parameter, AttrKey, StringStorage);
+
+    EOS_LobbySearch_SetParameterOptions SetParamOptions = {};
+    SetParamOptions.ApiVersion = EOS_LOBBYSEARCH_SETPARAMETER_API_LATEST;
+    SetParamOptions.Parameter = &Parameter;
+    SetParamOptions.ComparisonOp = ComparisonOp;
+
+    const EOS_EResult Result = EOS_LobbySearch_SetParameter(SearchHandle, &SetParamOptions);
+    if (Result != EOS_EResult::EOS_Success)
+    {
+        EM_LOG_ERROR(TEXT("Failed to set lobby search parameter %s: %s"), UTF8_TO_TCHAR(AttrKey), UTF8_TO_TCHAR(EOS_EResult_ToString(Result)));
+        return false;
+    }
+    return true;
+}
+
+bool FLobbySearch::ApplyParams()
+{
+    if (!Params.LobbyId.IsEmpty())
+    {
+        // Set the specific lobby ID to search for
+        FTCHARToUTF8 LobbyIdConverter(*Params.LobbyId);
+        EOS_LobbySearch_SetLobbyIdOptions SetLobbyIdOptions = {};
+        SetLobbyIdOptions.ApiVersion = EOS_LOBBYSEARCH_SETLOBBYID_API_LATEST;
+        SetLobbyIdOptions.LobbyId = LobbyIdConverter.Get();
+
+        return EOS_LobbySearch_SetLobbyId(SearchHandle, &SetLobbyIdOptions) == EOS_EResult::EOS_Success;
+    }
+
+    if (!Params.BucketId.IsEmpty() && !SetParameter(EOS_LOBBY_SEARCH_BUCKET_ID, FLobbyAttributeValue::MakeString(Params.BucketId), EOS_EComparisonOp::EOS_CO_EQUAL))
+    {
+        return false;
+    }
+
+    // Full lobbies never reach us
+    if (Params.MinAvailableSlots > 0
+        && !SetParameter(EOS_LOBBY_SEARCH_MINSLOTSAVAILABLE, FLobbyAttributeValue::MakeInt64(Params.MinAvailableSlots), EOS_EComparisonOp::EOS_CO_GREATERTHANOREQUAL))
+    {
+        return false;
+    }
+
+    for (const FLobbySearchFilter& Filter : Params.Filters)
+    {
+        if (Filter.Key.IsEmpty() || !Filter.Value.IsSet())
+        {
+            EM_LOG_WARNING(TEXT("Skipping lobby search filter without key or value"));
+            continue;
+        }
+
+        FTCHARToUTF8 KeyConverter(*Filter.Key);
+        bool bApplied = false;
+        switch (Filter.Comparison)
+        {
+        case ELobbySearchComparison::Equal:
+            bApplied = SetParameter(KeyConverter.Get(), Filter.Value, EOS_EComparisonOp::EOS_CO_EQUAL);
+            break;
+        case ELobbySearchComparison::NotEqual:
+            bApplied = SetParameter(KeyConverter.Get(), Filter.Value, EOS_EComparisonOp::EOS_CO_NOTEQUAL);
+            break;
+        case ELobbySearchComparison::GreaterThan:
+            bApplied = SetParameter(KeyConverter.Get(), Filter.Value, EOS_EComparisonOp::EOS_CO_GREATERTHAN);
+            break;
+        case ELobbySearchComparison::GreaterThanOrEqual:
+            bApplied = SetParameter(KeyConverter.Get(), Filter.Value, EOS_EComparisonOp::EOS_CO_GREATERTHANOREQUAL);
+            break;
+        case ELobbySearchComparison::LessThan:
+            bApplied = SetParameter(KeyConverter.Get(), Filter.Value, EOS_EComparisonOp::EOS_CO_LESSTHAN);
+            break;
+        case ELobbySearchComparison::LessThanOrEqual:
+            bApplied = SetParameter(KeyConverter.Get(), Filter.Value, EOS_EComparisonOp::EOS_CO_LESSTHANOREQUAL);
+            break;
+        case ELobbySearchComparison::Range:
+            bApplied = SetParameter(KeyConverter.Get(), Filter.Value, EOS_EComparisonOp::EOS_CO_GREATERTHANOREQUAL)
+                && (!Filter.MaxValue.IsSet() || SetParameter(KeyConverter.Get(), Filter.MaxValue, EOS_EComparisonOp::EOS_CO_LESSTHANOREQUAL));
+            break;
+        case ELobbySearchComparison::Contains:
+            bApplied = SetParameter(KeyConverter.Get(), Filter.Value, EOS_EComparisonOp::EOS_CO_CONTAINS);
+            break;
+        case ELobbySearchComparison::AnyOf:
+            bApplied = SetParameter(KeyConverter.Get(), Filter.Value, EOS_EComparisonOp::EOS_CO_ANYOF);
+            break;
+        }
+
+        if (!bApplied)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void FLobbySearch::Cancel()
+{
+    if (bCancelled)
+    {
+        return;
+    }
+    bCancelled = true;
+
+    StopConverting();
+
+    if (!bFound && SearchHandle)
+    {
+        EM_LOG_INFO(TEXT("Lobby search %d cancelled"), RequestId);
+        FOnLobbySearchFound Listeners = MoveTemp(OnFound);
+        Listeners.Broadcast(EOS_EResult::EOS_Canceled);
+    }
+    OnFound.Clear();
+    OnPage.Unbind();
+
+    if (SearchHandle)
+    {
+        EOS_LobbySearch_Release(SearchHandle);
+        SearchHandle = nullptr;
+    }
+}
+
+bool FLobbySearch::ReleaseListener()
+{
+    NumListeners = FMath::Max(0, NumListeners - 1);
+    if (NumListeners == 0)
+    {
+        Cancel();
+        return true;
+    }
+    return false;
+}
+
+EOS_HLobbyDetails FLobbySearch::CopyResultDetails(uint32 Index) const
+{
+    if (!SearchHandle || Index >= ResultCount)
+    {
+        return nullptr;
+    }
+
+    EOS_LobbySearch_CopySearchResultByIndexOptions CopyOptions = {};
+    CopyOptions.ApiVersion = EOS_LOBBYSEARCH_COPYSEARCHRESULTBYINDEX_API_LATEST;
+    CopyOptions.LobbyIndex = Index;
+
+    EOS_HLobbyDetails LobbyDetails = nullptr;
+    if (EOS_LobbySearch_CopySearchResultByIndex(SearchHandle, &CopyOptions, &LobbyDetails) != EOS_EResult::EOS_Success)
+    {
+        return nullptr;
+    }
+    return LobbyDetails;
+}
+
+bool FLobbySearch::RequestNextPage()
+{
+    if (!HasMorePages())
+    {
+        return false;
+    }
+
+    RequestedPages = FMath::Max(RequestedPages, DeliveredPages) + 1;
+    if (bFound)
+    {
+        // Might be prefetched already
+        DeliverPages();
+        StartConverting();
+    }
+    return true;
+}
+
+void FLobbySearch::RequestAllPages()
+{
+    bAllPages = true;
+    if (bFound)
+    {
+        RequestedPages = FMath::Max(1, FMath::DivideAndRoundUp<int32>(ResultCount, PageSize));
+        DeliverPages();
+        StartConverting();
+    }
+}
+
+void FLobbySearch::OnFindComplete(const EOS_LobbySearch_FindCallbackInfo* Data)
+{
+    FFindContext* Context = static_cast<FFindContext*>(Data->ClientData);
+    TSharedPtr<FLobbySearch> Search = Context->Search.Pin();
+    delete Context;
+
+    // Cancelled or dropped while the backend was busy
+    if (!Search.IsValid() || !Search->SearchHandle)
+    {
+        return;
+    }
+
+    if (Data->ResultCode == EOS_EResult::EOS_Success)
+    {
+        EOS_LobbySearch_GetSearchResultCountOptions CountOptions = {};
+        CountOptions.ApiVersion = EOS_LOBBYSEARCH_GETSEARCHRESULTCOUNT_API_LATEST;
+        Search->ResultCount = EOS_LobbySearch_GetSearchResultCount(Search->SearchHandle, &CountOptions);
+        Search->Results.Reserve(Search->ResultCount);
+
+        if (Search->ResultCount == 0)
+        {
+            EM_LOG_WARNING(TEXT("No lobbies found matching the search criteria"));
+        }
+    }
+
+    Search->bFound = true;
+    Search->RequestedPages = FMath::Max(Search->RequestedPages, 1);
+    if (Search->bAllPages)
+    {
+        Search->RequestedPages = FMath::Max(Search->RequestedPages, FMath::DivideAndRoundUp<int32>(Search->ResultCount, Search->PageSize));
+    }
+
+    // Listeners only wait for this once
+    FOnLobbySearchFound Listeners = MoveTemp(Search->OnFound);
+    Search->OnFound.Clear();
+    Listeners.Broadcast(Data->ResultCode);
+
+    if (Data->ResultCode == EOS_EResult::EOS_Success && Search->SearchHandle)
+    {
+        Search->DeliverPages();
+        Search->StartConverting();
+    }
+}
+
+void FLobbySearch::StartConverting()
+{
+    if (!TickerHandle.IsValid() && SearchHandle && Results.Num() < static_cast<int32>(ResultCount))
+    {
+        TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(this, &FLobbySearch::Tick));
+    }
+}
+
+void FLobbySearch::StopConverting()
+{
+    if (TickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+        TickerHandle.Reset();
+    }
+}
+
+bool FLobbySearch::Tick(float DeltaTime)
+{
+    // Convert up to one page past what was asked for, within the frame budget (at least one row per frame)
+    const int32 Target = FMath::Min<int32>(ResultCount, (RequestedPages + 1) * PageSize);
+    const double StartTime = FPlatformTime::Seconds();
+
+    while (Results.Num() < Target)
+    {
+        if (!ConvertNext() || FPlatformTime::Seconds() - StartTime >= FrameBudgetSeconds)
+        {
+            break;
+        }
+    }
+
+    // Keep a reference, a page listener may drop this search
+    TSharedRef<FLobbySearch> KeepAlive = AsShared();
+    DeliverPages();
+
+    if (!SearchHandle || Results.Num() >= Target)
+    {
+        TickerHandle.Reset();
+        return false;
+    }
+    return true;
+}
+
+bool FLobbySearch::ConvertNext()
+{
+    if (!SearchHandle || Results.Num() >= static_cast<int32>(ResultCount))
+    {
+        return false;
+    }
+
+    const uint32 Index = Results.Num();
+    if (EOS_HLobbyDetails LobbyDetails = CopyResultDetails(Index))
+    {
+        Results.Add(MakeLobbyInfo(LobbyDetails));
+        EOS_LobbyDetails_Release(LobbyDetails);
+    }
+    else
+    {
+        // Keep indexes lined up with the search results
+        EM_LOG_WARNING(TEXT("Failed to copy lobby search result %u"), Index);
+        Results.AddDefaulted();
+    }
+
+    return true;
+}
+
+void FLobbySearch::DeliverPages()
+{
+    while (DeliveredPages < RequestedPages)
+    {
+        const int32 PageStart = DeliveredPages * PageSize;
+        const int32 PageEnd = FMath::Min<int32>(PageStart + PageSize, ResultCount);
+
+        // Page not converted yet (an empty search still gets its one empty page)
+        if (Results.Num() < PageEnd || (PageStart >= PageEnd && PageStart > 0))
+        {
+            break;
+        }
+
+        TArray<FLobbyInfo> Page;
+        Page.Reserve(PageEnd - PageStart);
+        for (int32 Index = PageStart; Index < PageEnd; Index++)
+        {
+            if (!Results[Index].LobbyId.IsEmpty())
+            {
+                Page.Add(Results[Index]);
+            }
+        }
+
+        const int32 PageIndex = DeliveredPages++;
+        OnPage.ExecuteIfBound(Page, PageIndex, HasMorePages());
+    }
+}
+
+FLobbyInfo FLobbySearch::MakeLobbyInfo(EOS_HLobbyDetails LobbyDetails)
+{
+    FLobbyInfo LobbyInfoStruct;
+
+    EOS_LobbyDetails_CopyInfoOptions InfoOptions = {};
+    InfoOptions.ApiVersion = EOS_LOBBYDETAILS_COPYINFO_API_LATEST;
+
+    EOS_LobbyDetails_Info* LobbyInfo = nullptr;
+    if (EOS_LobbyDetails_CopyInfo(LobbyDetails, &InfoOptions, &LobbyInfo) != EOS_EResult::EOS_Success || !LobbyInfo)
+    {
+        return LobbyInfoStruct;
+    }
+
+    // Create lobby info struct
+    LobbyInfoStruct.LobbyId = UTF8_TO_TCHAR(LobbyInfo->LobbyId);
+    LobbyInfoStruct.MaxPlayers = LobbyInfo->MaxMembers;
+    LobbyInfoStruct.CurrentPlayers = LobbyInfo->MaxMembers - LobbyInfo->AvailableSlots;
+    LobbyInfoStruct.BucketId = UTF8_TO_TCHAR(LobbyInfo->BucketId ? LobbyInfo->BucketId : "");
+
+    // Convert owner ProductUserId to string
+    if (LobbyInfo->LobbyOwnerUserId)
+    {
+        char OwnerIdStr[EOS_PRODUCTUSERID_MAX_LENGTH + 1];
+        int32_t BufferSize = sizeof(OwnerIdStr);
+        if (EOS_ProductUserId_ToString(LobbyInfo->LobbyOwnerUserId, OwnerIdStr, &BufferSize) == EOS_EResult::EOS_Success)
+        {
+            LobbyInfoStruct.OwnerUserId = UTF8_TO_TCHAR(OwnerIdStr);
+        }
+        else
+        {
+            LobbyInfoStruct.OwnerUserId = TEXT("Unknown");
+        }
+    }
+    else
+    {
+        LobbyInfoStruct.OwnerUserId = TEXT("No Owner");
+    }
+
+    LobbyInfoStruct.LobbyName = TEXT("Unnamed Lobby"); // Default
+
+    // Name, mode, map... come packed in one attribute
+    EOS_LobbyDetails_CopyAttributeByKeyOptions AttrOptions = {};
+    AttrOptions.ApiVersion = EOS_LOBBYDETAILS_COPYATTRIBUTEBYKEY_API_LATEST;
+    AttrOptions.AttrKey = LobbyAttributeKeys::SummaryUtf8;
+
+    EOS_Lobby_Attribute* SummaryAttribute = nullptr;
+    if (EOS_LobbyDetails_CopyAttributeByKey(LobbyDetails, &AttrOptions, &SummaryAttribute) == EOS_EResult::EOS_Success && SummaryAttribute)
+    {
+        FLobbySummary Summary;
+        if (SummaryAttribute->Data && SummaryAttribute->Data->ValueType == EOS_ELobbyAttributeType::EOS_AT_STRING
+            && FLobbySummary::Decode(UTF8_TO_TCHAR(SummaryAttribute->Data->Value.AsUtf8), Summary))
+        {
+            Summary.ApplyTo(LobbyInfoStruct);
+        }
+        EOS_Lobby_Attribute_Release(SummaryAttribute);
+    }
+
+    EM_LOG_INFO(TEXT("Found lobby: %s (Owner: %s, Players: %d/%d)"),
+        *LobbyInfoStruct.LobbyId,
+        *LobbyInfoStruct.OwnerUserId,
+        LobbyInfoStruct.CurrentPlayers,
+        LobbyInfoStruct.MaxPlayers);
+
+    EOS_LobbyDetails_Info_Release(LobbyInfo);
+    return LobbyInfoStruct;
+}
@@ -0,0 +1,67 @@
+#include "Lobby/LobbySearchCache.h"
+
+namespace
+{
+    // Entries nobody asked for in this long are dropped when something new is stored
+    constexpr double MaxEntryAgeSeconds = 600.0;
+
+    bool IsSameRow(const FLobbyInfo& A, const FLobbyInfo& B)
+    {
+        return A.LobbyId == B.LobbyId
+            && A.LobbyName == B.LobbyName
+            && A.OwnerUserId == B.OwnerUserId
+            && A.CurrentPlayers == B.CurrentPlayers
+            && A.MaxPlayers == B.MaxPlayers
+            && A.BucketId == B.BucketId
+            && A.GameMode == B.GameMode
+            && A.MapName == B.MapName
+            && A.Region == B.Region
+            && A.BuildId == B.BuildId
+            && A.bIsPrivate == B.bIsPrivate;
+    }
+}
+
+bool FLobbySearchCache::IsFresh(const FEntry& Entry, double TTLSeconds) const
+{
+    return Entry.bComplete && FPlatformTime::Seconds() - Entry.FetchedAt < TTLSeconds;
+}
+
+void FLobbySearchCache::Store(const FString& Key, const TArray<FLobbyInfo>& Lobbies, bool bComplete)
+{
+    const double Now = FPlatformTime::Seconds();
+    for (auto It = Entries.CreateIterator(); It; ++It)
+    {
+        if (Now - It.Value().FetchedAt > MaxEntryAgeSeconds)
+        {
+            It.RemoveCurrent();
+        }
+    }
+
+    FEntry& Entry = Entries.FindOrAdd(Key);
+    Entry.Lobbies = Lobbies;
+    Entry.FetchedAt = Now;
+    Entry.bComplete = bComplete;
+}
+
+void FLobbySearchCache::Diff(const TArray<FLobbyInfo>& OldLobbies, const TArray<FLobbyInfo>& NewLobbies, TArray<FLobbyInfo>& OutChanged, TArray<FString>& OutRemovedIds)
+{
+    TMap<FString, const FLobbyInfo*> OldById;
+    OldById.Reserve(OldLobbies.Num());
+    for (const FLobbyInfo& Lobby : OldLobbies)
+    {
+        OldById.Add(Lobby.LobbyId, &Lobby);
+    }
+
+    for (const FLobbyInfo& Lobby : NewLobbies)
+    {
+        const FLobbyInfo* const* OldLobby = OldById.Find(Lobby.LobbyId);
+        if (!OldLobby || !IsSameRow(**OldLobby, Lobby))
+        {
+            OutChanged.Add(Lobby);
+        }
+        OldById.Remove(Lobby.LobbyId);
+    }
+
+    // Whatever is left was not in the new results
+    OldById.GenerateKeyArray(OutRemovedIds);
+}
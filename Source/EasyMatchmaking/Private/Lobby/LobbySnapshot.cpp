@@ -0,0 +1,216 @@
+#include "Lobby/LobbySnapshot.h"
+
+#include <eos_lobby.h>
+
+#include "EasyMatchmakingLog.h"
+
+namespace
+{
+    FString ProductUserIdToString(EOS_ProductUserId UserId)
+    {
+        if (!UserId)
+        {
+            return FString();
+        }
+
+        char UserIdStr[EOS_PRODUCTUSERID_MAX_LENGTH + 1];
+        int32_t BufferSize = sizeof(UserIdStr);
+        if (EOS_ProductUserId_ToString(UserId, UserIdStr, &BufferSize) == EOS_EResult::EOS_Success)
+        {
+            return FString(UTF8_TO_TCHAR(UserIdStr));
+        }
+
+        return FString();
+    }
+}
+
+const FLobbyAttributeValue& FLobbySnapshot::GetAttributeFrom(const TArray<FLobbyAttributeValue>& Values, int32 Slot)
+{
+    static const FLobbyAttributeValue UnsetValue;
+    return Values.IsValidIndex(Slot) ? Values[Slot] : UnsetValue;
+}
+
+const FLobbyAttributeValue& FLobbySnapshot::GetAttribute(int32 Slot) const
+{
+    return GetAttributeFrom(Attributes, Slot);
+}
+
+const FLobbySnapshotMember* FLobbySnapshot::FindMember(EOS_ProductUserId UserId) const
+{
+    return Members.FindByPredicate([UserId](const FLobbySnapshotMember& Member) { return Member.UserId == UserId; });
+}
+
+bool FLobbySnapshot::ReadInfo(EOS_HLobbyDetails LobbyDetails)
+{
+    EOS_LobbyDetails_CopyInfoOptions InfoOptions = {};
+    InfoOptions.ApiVersion = EOS_LOBBYDETAILS_COPYINFO_API_LATEST;
+
+    EOS_LobbyDetails_Info* LobbyInfo = nullptr;
+    if (EOS_LobbyDetails_CopyInfo(LobbyDetails, &InfoOptions, &LobbyInfo) != EOS_EResult::EOS_Success || !LobbyInfo)
+    {
+        EM_LOG_ERROR(TEXT("Failed to copy lobby info for snapshot"));
+        return false;
+    }
+
+    LobbyId = UTF8_TO_TCHAR(LobbyInfo->LobbyId ? LobbyInfo->LobbyId : "");
+    BucketId = UTF8_TO_TCHAR(LobbyInfo->BucketId ? LobbyInfo->BucketId : "");
+    if (OwnerUserId != LobbyInfo->LobbyOwnerUserId || OwnerUserIdString.IsEmpty())
+    {
+        OwnerUserId = LobbyInfo->LobbyOwnerUserId;
+        OwnerUserIdString = ProductUserIdToString(LobbyInfo->LobbyOwnerUserId);
+    }
+    MaxMembers = LobbyInfo->MaxMembers;
+    AvailableSlots = LobbyInfo->AvailableSlots;
+
+    EOS_LobbyDetails_Info_Release(LobbyInfo);
+    return true;
+}
+
+void FLobbySnapshot::ReadAttributes(EOS_HLobbyDetails LobbyDetails, const FLobbyAttributeSchema& Schema)
+{
+    const TArray<FLobbyAttributeSchema::FKey>& Keys = Schema.GetKeys(ELobbyAttributeScope::Lobby);
+    Attributes.SetNum(Keys.Num());
+
+    for (int32 Slot = 0; Slot < Keys.Num(); Slot++)
+    {
+        EOS_LobbyDetails_CopyAttributeByKeyOptions AttrOptions = {};
+        AttrOptions.ApiVersion = EOS_LOBBYDETAILS_COPYATTRIBUTEBYKEY_API_LATEST;
+        AttrOptions.AttrKey = Keys[Slot].Utf8Key.GetData();
+
+        EOS_Lobby_Attribute* Attribute = nullptr;
+        if (EOS_LobbyDetails_CopyAttributeByKey(LobbyDetails, &AttrOptions, &Attribute) == EOS_EResult::EOS_Success && Attribute)
+        {
+            Attributes[Slot] = Attribute->Data ? FLobbyAttributeValue::FromEOS(*Attribute->Data) : FLobbyAttributeValue();
+            EOS_Lobby_Attribute_Release(Attribute);
+        }
+        else
+        {
+            Attributes[Slot] = FLobbyAttributeValue();
+        }
+    }
+}
+
+FLobbySnapshotMember FLobbySnapshot::ReadMember(EOS_HLobbyDetails LobbyDetails, EOS_ProductUserId UserId, const FLobbyAttributeSchema& Schema, const FLobbySnapshotMember* Previous)
+{
+    FLobbySnapshotMember Member;
+    Member.UserId = UserId;
+    Member.UserIdString = Previous ? Previous->UserIdString : ProductUserIdToString(UserId);
+
+    const TArray<FLobbyAttributeSchema::FKey>& Keys = Schema.GetKeys(ELobbyAttributeScope::Member);
+    Member.Attributes.SetNum(Keys.Num());
+
+    for (int32 Slot = 0; Slot < Keys.Num(); Slot++)
+    {
+        EOS_LobbyDetails_CopyMemberAttributeByKeyOptions AttrOptions = {};
+        AttrOptions.ApiVersion = EOS_LOBBYDETAILS_COPYMEMBERATTRIBUTEBYKEY_API_LATEST;
+        AttrOptions.TargetUserId = UserId;
+        AttrOptions.AttrKey = Keys[Slot].Utf8Key.GetData();
+
+        EOS_Lobby_Attribute* Attribute = nullptr;
+        if (EOS_LobbyDetails_CopyMemberAttributeByKey(LobbyDetails, &AttrOptions, &Attribute) == EOS_EResult::EOS_Success && Attribute)
+        {
+            if (Attribute->Data)
+            {
+                Member.Attributes[Slot] = FLobbyAttributeValue::FromEOS(*Attribute->Data);
+            }
+            EOS_Lobby_Attribute_Release(Attribute);
+        }
+    }
+
+    const FLobbyAttributeValue& Ready = GetAttributeFrom(Member.Attributes, FLobbyAttributeSchema::ReadySlot);
+    Member.bIsReady = Ready.Type == ELobbyAttributeType::Bool && Ready.BoolValue;
+
+    return Member;
+}
+
+TSharedPtr<const FLobbySnapshot> FLobbySnapshot::Build(EOS_HLobbyDetails LobbyDetails, uint32 InVersion, const FLobbyAttributeSchema& Schema, const FLobbySnapshot* Previous)
+{
+    if (!LobbyDetails)
+    {
+        return nullptr;
+    }
+
+    TSharedRef<FLobbySnapshot> Snapshot = MakeShared<FLobbySnapshot>();
+    Snapshot->Version = InVersion;
+    if (!Snapshot->ReadInfo(LobbyDetails))
+    {
+        return nullptr;
+    }
+
+    // Members and their declared attributes
+    EOS_LobbyDetails_GetMemberCountOptions MemberCountOptions = {};
+    MemberCountOptions.ApiVersion = EOS_LOBBYDETAILS_GETMEMBERCOUNT_API_LATEST;
+    const uint32_t MemberCount = EOS_LobbyDetails_GetMemberCount(LobbyDetails, &MemberCountOptions);
+
+    Snapshot->Members.Reserve(MemberCount);
+    for (uint32_t i = 0; i < MemberCount; i++)
+    {
+        EOS_LobbyDetails_GetMemberByIndexOptions MemberOptions = {};
+        MemberOptions.ApiVersion = EOS_LOBBYDETAILS_GETMEMBERBYINDEX_API_LATEST;
+        MemberOptions.MemberIndex = i;
+
+        EOS_ProductUserId MemberUserId = EOS_LobbyDetails_GetMemberByIndex(LobbyDetails, &MemberOptions);
+        if (MemberUserId)
+        {
+            Snapshot->Members.Add(ReadMember(LobbyDetails, MemberUserId, Schema, Previous ? Previous->FindMember(MemberUserId) : nullptr));
+        }
+    }
+
+    // Declared lobby attributes (session address etc.)
+    Snapshot->ReadAttributes(LobbyDetails, Schema);
+
+    return Snapshot;
+}
+
+TSharedPtr<const FLobbySnapshot> FLobbySnapshot::WithMemberUpdated(EOS_HLobbyDetails LobbyDetails, EOS_ProductUserId UserId, uint32 InVersion, const FLobbyAttributeSchema& Schema) const
+{
+    if (!LobbyDetails || !UserId)
+    {
+        return nullptr;
+    }
+
+    TSharedRef<FLobbySnapshot> Snapshot = MakeShared<FLobbySnapshot>(*this);
+    Snapshot->Version = InVersion;
+    if (!Snapshot->ReadInfo(LobbyDetails))
+    {
+        return nullptr;
+    }
+
+    if (FLobbySnapshotMember* Existing = Snapshot->Members.FindByPredicate([UserId](const FLobbySnapshotMember& Member) { return Member.UserId == UserId; }))
+    {
+        *Existing = ReadMember(LobbyDetails, UserId, Schema, Existing);
+    }
+    else
+    {
+        Snapshot->Members.Add(ReadMember(LobbyDetails, UserId, Schema, nullptr));
+    }
+
+    return Snapshot;
+}
+
+TSharedPtr<const FLobbySnapshot> FLobbySnapshot::WithMemberRemoved(EOS_ProductUserId UserId, uint32 InVersion) const
+{
+    TSharedRef<FLobbySnapshot> Snapshot = MakeShared<FLobbySnapshot>(*this);
+    Snapshot->Version = InVersion;
+
+    // RemoveAll keeps the order of the remaining members
+    if (Snapshot->Members.RemoveAll([UserId](const FLobbySnapshotMember& Member) { return Member.UserId == UserId; }) > 0)
+    {
+        Snapshot->AvailableSlots = FMath::Min(Snapshot->AvailableSlots + 1, Snapshot->MaxMembers);
+    }
+
+    return Snapshot;
+}
+
+TSharedPtr<const FLobbySnapshot> FLobbySnapshot::WithOwner(EOS_ProductUserId NewOwnerId, uint32 InVersion) const
+{
+    TSharedRef<FLobbySnapshot> Snapshot = MakeShared<FLobbySnapshot>(*this);
+    Snapshot->Version = InVersion;
+    Snapshot->OwnerUserId = NewOwnerId;
+
+    // The new owner is a member, so its id string is already here
+    const FLobbySnapshotMember* Owner = FindMember(NewOwnerId);
+    Snapshot->OwnerUserIdString = Owner ? Owner->UserIdString : FString();
+
+    return Snapshot;
+}
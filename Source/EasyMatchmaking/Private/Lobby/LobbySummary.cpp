@@ -0,0 +1,133 @@
+#include "Lobby/LobbySummary.h"
+
+#include "Lobby/LobbySearch.h"
+
+namespace
+{
+    constexpr TCHAR Separator = TEXT('|');
+    constexpr TCHAR Escape = TEXT('\\');
+
+    enum ESummaryFlags : int32
+    {
+        Private = 1 << 0
+    };
+
+    void AppendField(FString& Out, const FString& Field)
+    {
+        Out.AppendChar(Separator);
+        for (const TCHAR Char : Field.Left(FLobbySummary::MaxFieldLength))
+        {
+            if (Char == Separator || Char == Escape)
+            {
+                Out.AppendChar(Escape);
+            }
+            Out.AppendChar(Char);
+        }
+    }
+
+    void SplitFields(const FString& Encoded, TArray<FString>& OutFields)
+    {
+        FString Field;
+        bool bEscaped = false;
+        for (const TCHAR Char : Encoded)
+        {
+            if (bEscaped)
+            {
+                Field.AppendChar(Char);
+                bEscaped = false;
+            }
+            else if (Char == Escape)
+            {
+                bEscaped = true;
+            }
+            else if (Char == Separator)
+            {
+                OutFields.Add(MoveTemp(Field));
+                Field.Reset();
+            }
+            else
+            {
+                Field.AppendChar(Char);
+            }
+        }
+        OutFields.Add(MoveTemp(Field));
+    }
+}
+
+FString FLobbySummary::Encode() const
+{
+    FString Encoded = LexToString(CurrentVersion);
+    AppendField(Encoded, LobbyName);
+    AppendField(Encoded, GameMode);
+    AppendField(Encoded, MapName);
+    AppendField(Encoded, Region);
+    AppendField(Encoded, BuildId);
+    AppendField(Encoded, LexToString(bIsPrivate ? ESummaryFlags::Private : 0));
+    return Encoded;
+}
+
+bool FLobbySummary::Decode(const FString& Encoded, FLobbySummary& OutSummary)
+{
+    TArray<FString> Fields;
+    SplitFields(Encoded, Fields);
+
+    int32 Version = 0;
+    if (Fields.Num() < 7 || !LexTryParseString(Version, *Fields[0]) || Version < 1)
+    {
+        return false;
+    }
+
+    // Version 1 layout, newer versions only append fields
+    OutSummary.LobbyName = MoveTemp(Fields[1]);
+    OutSummary.GameMode = MoveTemp(Fields[2]);
+    OutSummary.MapName = MoveTemp(Fields[3]);
+    OutSummary.Region = MoveTemp(Fields[4]);
+    OutSummary.BuildId = MoveTemp(Fields[5]);
+
+    int32 Flags = 0;
+    LexTryParseString(Flags, *Fields[6]);
+    OutSummary.bIsPrivate = (Flags & ESummaryFlags::Private) != 0;
+
+    return true;
+}
+
+void FLobbySummary::ApplyTo(FLobbyInfo& LobbyInfo) const
+{
+    if (!LobbyName.IsEmpty())
+    {
+        LobbyInfo.LobbyName = LobbyName;
+    }
+    LobbyInfo.GameMode = GameMode;
+    LobbyInfo.MapName = MapName;
+    LobbyInfo.Region = Region;
+    LobbyInfo.BuildId = BuildId;
+    LobbyInfo.bIsPrivate = bIsPrivate;
+}
+
+FString FLobbySessionServer::Encode() const
+{
+    FString Encoded = LexToString(CurrentVersion);
+    AppendField(Encoded, SessionId);
+    AppendField(Encoded, ServerAddress);
+    AppendField(Encoded, BucketId);
+    AppendField(Encoded, Region);
+    return Encoded;
+}
+
+bool FLobbySessionServer::Decode(const FString& Encoded, FLobbySessionServer& OutServer)
+{
+    TArray<FString> Fields;
+    SplitFields(Encoded, Fields);
+
+    int32 Version = 0;
+    if (Fields.Num() < 5 || !LexTryParseString(Version, *Fields[0]) || Version < 1)
+    {
+        return false;
+    }
+
+    OutServer.SessionId = MoveTemp(Fields[1]);
+    OutServer.ServerAddress = MoveTemp(Fields[2]);
+    OutServer.BucketId = MoveTemp(Fields[3]);
+    OutServer.Region = MoveTemp(Fields[4]);
+    return true;
+}
@@ -0,0 +1,64 @@
+#include "Lobby/SessionJoinSchedule.h"
+
+int32 SessionJoinSchedule::GetSlot(const FLobbySnapshot& Snapshot, EOS_ProductUserId UserId)
+{
+    const FLobbySnapshotMember* Self = Snapshot.FindMember(UserId);
+    if (!Self || UserId == Snapshot.OwnerUserId)
+    {
+        return INDEX_NONE;
+    }
+
+    // Members see each other in different orders, the ids are the same everywhere
+    int32 Slot = 0;
+    for (const FLobbySnapshotMember& Member : Snapshot.Members)
+    {
+        if (Member.UserId != Snapshot.OwnerUserId && Member.UserIdString < Self->UserIdString)
+        {
+            Slot++;
+        }
+    }
+    return Slot;
+}
+
+float SessionJoinSchedule::GetJoinDelay(int32 Slot, float Spacing)
+{
+    return FMath::Max(0, Slot) * FMath::Max(0.0f, Spacing);
+}
+
+float SessionJoinSchedule::GetRetryDelay(int32 Slot, int32 Attempt, float Spacing, float RetryDelay)
+{
+    const float Backoff = FMath::Max(0.0f, RetryDelay) * FMath::Pow(2.0f, FMath::Max(0, Attempt - 2));
+    return Backoff + GetJoinDelay(Slot, Spacing);
+}
+
+bool SessionJoinSchedule::IsBusy(EOS_EResult Result)
+{
+    switch (Result)
+    {
+    case EOS_EResult::EOS_AlreadyPending:
+    case EOS_EResult::EOS_TooManyRequests:
+    case EOS_EResult::EOS_TimedOut:
+    case EOS_EResult::EOS_Sessions_OutOfSync:
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool SessionJoinSchedule::HaveAllMembersJoined(const FLobbySnapshot& Snapshot, const FString& SessionId)
+{
+    for (const FLobbySnapshotMember& Member : Snapshot.Members)
+    {
+        if (Member.UserId == Snapshot.OwnerUserId)
+        {
+            continue;
+        }
+
+        const FLobbyAttributeValue& Joined = FLobbySnapshot::GetAttributeFrom(Member.Attributes, FLobbyAttributeSchema::JoinedSessionSlot);
+        if (Joined.Type != ELobbyAttributeType::String || Joined.StringValue != SessionId)
+        {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,151 @@
+#include "Matchmaking/RegionLatency.h"
+
+#include "Icmp.h"
+
+#include "EasyMatchmakingLog.h"
+
+void FRegionLatencyProbe::Start(const TArray<FMatchmakingRegion>& InRegions, int32 InPingCount, float InTimeout, FOnRegionLatenciesMeasured&& InOnComplete)
+{
+    if (IsRunning())
+    {
+        EM_LOG_WARNING(TEXT("Region latencies are already being measured"));
+        return;
+    }
+
+    Regions = InRegions.FilterByPredicate([](const FMatchmakingRegion& Region) { return !Region.Name.IsEmpty() && !Region.PingAddress.IsEmpty(); });
+    PingCount = FMath::Max(1, InPingCount);
+    Timeout = FMath::Max(0.1f, InTimeout);
+    OnComplete = MoveTemp(InOnComplete);
+
+    Samples.Reset();
+    Samples.SetNum(Regions.Num());
+    PingsSent.Reset();
+    PingsSent.SetNumZeroed(Regions.Num());
+    RegionsLeft = Regions.Num();
+
+    if (RegionsLeft == 0)
+    {
+        Finish();
+        return;
+    }
+
+    EM_LOG_INFO(TEXT("Measuring latency to %d regions"), Regions.Num());
+    for (int32 RegionIndex = 0; RegionIndex < Regions.Num(); RegionIndex++)
+    {
+        SendPing(RegionIndex);
+    }
+}
+
+void FRegionLatencyProbe::SendPing(int32 RegionIndex)
+{
+    PingsSent[RegionIndex]++;
+
+    // Echo results come back on the game thread
+    TWeakPtr<FRegionLatencyProbe> WeakProbe = AsShared();
+    FIcmp::IcmpEcho(Regions[RegionIndex].PingAddress, Timeout, [WeakProbe, RegionIndex](FIcmpEchoResult Result)
+    {
+        if (TSharedPtr<FRegionLatencyProbe> Probe = WeakProbe.Pin())
+        {
+            Probe->HandleEcho(RegionIndex, Result);
+        }
+    });
+}
+
+void FRegionLatencyProbe::HandleEcho(int32 RegionIndex, const FIcmpEchoResult& Result)
+{
+    if (Result.Status == EIcmpResponseStatus::Success)
+    {
+        Samples[RegionIndex].Add(FMath::RoundToInt(Result.Time * 1000.0f));
+    }
+
+    if (PingsSent[RegionIndex] < PingCount)
+    {
+        SendPing(RegionIndex);
+        return;
+    }
+
+    if (--RegionsLeft == 0)
+    {
+        Finish();
+    }
+}
+
+void FRegionLatencyProbe::Finish()
+{
+    TMap<FString, int32> Latencies;
+    for (int32 RegionIndex = 0; RegionIndex < Regions.Num(); RegionIndex++)
+    {
+        TArray<int32>& RegionSamples = Samples[RegionIndex];
+        if (RegionSamples.Num() == 0)
+        {
+            EM_LOG_WARNING(TEXT("Region %s did not answer"), *Regions[RegionIndex].Name);
+            continue;
+        }
+
+        // Median, one slow ping should not move a region
+        RegionSamples.Sort();
+        Latencies.Add(Regions[RegionIndex].Name, RegionSamples[RegionSamples.Num() / 2]);
+        EM_LOG_INFO(TEXT("Region %s: %d ms"), *Regions[RegionIndex].Name, RegionSamples[RegionSamples.Num() / 2]);
+    }
+
+    FOnRegionLatenciesMeasured Callback = MoveTemp(OnComplete);
+    OnComplete.Unbind();
+    Callback.ExecuteIfBound(Latencies);
+}
+
+int32 RegionLatency::Find(const TMap<FString, int32>& Latencies, const FString& Region)
+{
+    const int32* Latency = Region.IsEmpty() ? nullptr : Latencies.Find(Region);
+    return Latency ? *Latency : INDEX_NONE;
+}
+
+FString RegionLatency::GetBestRegion(const TMap<FString, int32>& Latencies)
+{
+    FString BestRegion;
+    int32 BestLatency = MAX_int32;
+    for (const TPair<FString, int32>& Pair : Latencies)
+    {
+        if (Pair.Value < BestLatency)
+        {
+            BestRegion = Pair.Key;
+            BestLatency = Pair.Value;
+        }
+    }
+    return BestRegion;
+}
+
+int32 RegionLatency::GetWidenedCap(int32 BaseCapMs, int32 WidenMsPerSecond, int32 MaxCapMs, double WaitSeconds)
+{
+    if (BaseCapMs <= 0)
+    {
+        return 0;
+    }
+
+    const int32 Widened = BaseCapMs + FMath::FloorToInt(WidenMsPerSecond * FMath::Max(0.0, WaitSeconds));
+    return FMath::Min(Widened, FMath::Max(BaseCapMs, MaxCapMs));
+}
+
+TArray<FString> RegionLatency::GetRegionsWithin(const TMap<FString, int32>& Latencies, int32 CapMs)
+{
+    TArray<FString> Regions;
+    for (const TPair<FString, int32>& Pair : Latencies)
+    {
+        if (CapMs <= 0 || Pair.Value <= CapMs)
+        {
+            Regions.Add(Pair.Key);
+        }
+    }
+    return Regions;
+}
+
+FString RegionLatency::GetServerRegion()
+{
+    FString Region;
+    if (FParse::Value(FCommandLine::Get(), TEXT("Region="), Region) && !Region.IsEmpty())
+    {
+        return Region;
+    }
+
+    const UEasyMatchmakingSettings* Settings = UEasyMatchmakingSettings::Get();
+    return Settings ? Settings->ServerRegion : FString();
+}
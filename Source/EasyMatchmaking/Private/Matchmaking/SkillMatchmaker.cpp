@@ -0,0 +1,249 @@
+#include "Matchmaking/SkillMatchmaker.h"
+
+#include "Algo/BinarySearch.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+
+#include "EasyMatchmakingLog.h"
+
+FSkillMatchmaker::FSkillMatchmaker(const FSkillMatchmakerConfig& InConfig)
+    : Config(InConfig)
+{
+    Config.MatchSize = FMath::Max(1, Config.MatchSize);
+    Config.MaxScanPerSide = FMath::Max(1, Config.MaxScanPerSide);
+}
+
+double FSkillMatchmaker::GetWindow(const FSkillMatchmakerConfig& InConfig, double WaitSeconds)
+{
+    return FMath::Min(InConfig.InitialWindow + InConfig.WindowGrowthPerSecond * FMath::Max(0.0, WaitSeconds), InConfig.MaxWindow);
+}
+
+int32 FSkillMatchmaker::AddTicket(const FString& OwnerId, double Rating, int32 PartySize, double Now)
+{
+    if (PartySize < 1 || PartySize > Config.MatchSize)
+    {
+        EM_LOG_WARNING(TEXT("Party of %d does not fit into a match of %d"), PartySize, Config.MatchSize);
+        return INDEX_NONE;
+    }
+
+    FSkillTicket Ticket;
+    Ticket.TicketId = NextTicketId++;
+    Ticket.OwnerId = OwnerId;
+    Ticket.Rating = Rating;
+    Ticket.PartySize = PartySize;
+    Ticket.EnqueuedAt = Now;
+
+    const FIndexEntry Entry = { Rating, Ticket.TicketId, PartySize };
+    RatingIndex.Insert(Entry, Algo::LowerBound(RatingIndex, Entry));
+    ArrivalOrder.Add(Ticket.TicketId);
+    Tickets.Add(Ticket.TicketId, MoveTemp(Ticket));
+
+    return Entry.TicketId;
+}
+
+bool FSkillMatchmaker::RemoveTicket(int32 TicketId)
+{
+    const FSkillTicket* Ticket = Tickets.Find(TicketId);
+    if (!Ticket)
+    {
+        return false;
+    }
+
+    const int32 Index = Algo::BinarySearch(RatingIndex, FIndexEntry{ Ticket->Rating, TicketId, Ticket->PartySize });
+    if (Index != INDEX_NONE)
+    {
+        RatingIndex.RemoveAt(Index);
+    }
+
+    Tickets.Remove(TicketId);
+    return true;
+}
+
+void FSkillMatchmaker::Reset()
+{
+    Tickets.Reset();
+    RatingIndex.Reset();
+    ArrivalOrder.Reset();
+}
+
+int32 FSkillMatchmaker::RunMatchPass(double Now, TArray<FSkillMatch>& OutMatches)
+{
+    // Matched tickets stay in the index until the end of the pass, so indexes stay valid while we go
+    TBitArray<> Matched(false, RatingIndex.Num());
+    TArray<int32> MatchIndexes;
+    int32 NumMatches = 0;
+
+    // Oldest first, they have the widest windows and waited the longest
+    for (const int32 TicketId : ArrivalOrder)
+    {
+        const FSkillTicket* Ticket = Tickets.Find(TicketId);
+        if (!Ticket)
+        {
+            continue;
+        }
+
+        const int32 AnchorIndex = Algo::LowerBound(RatingIndex, FIndexEntry{ Ticket->Rating, TicketId, Ticket->PartySize });
+        if (!RatingIndex.IsValidIndex(AnchorIndex) || Matched[AnchorIndex])
+        {
+            continue;
+        }
+
+        if (!GatherMatch(AnchorIndex, GetWindow(*Ticket, Now), Matched, MatchIndexes))
+        {
+            continue;
+        }
+
+        FSkillMatch& Match = OutMatches.AddDefaulted_GetRef();
+        Match.MinRating = TNumericLimits<double>::Max();
+        Match.MaxRating = TNumericLimits<double>::Lowest();
+        Match.Tickets.Reserve(MatchIndexes.Num());
+
+        for (const int32 Index : MatchIndexes)
+        {
+            Matched[Index] = true;
+
+            const FIndexEntry& Entry = RatingIndex[Index];
+            Match.Tickets.Add(Tickets.FindChecked(Entry.TicketId));
+            Match.MinRating = FMath::Min(Match.MinRating, Entry.Rating);
+            Match.MaxRating = FMath::Max(Match.MaxRating, Entry.Rating);
+        }
+        NumMatches++;
+    }
+
+    if (NumMatches > 0)
+    {
+        // One compaction for the whole pass instead of a RemoveAt per ticket
+        int32 WriteIndex = 0;
+        for (int32 ReadIndex = 0; ReadIndex < RatingIndex.Num(); ReadIndex++)
+        {
+            if (Matched[ReadIndex])
+            {
+                Tickets.Remove(RatingIndex[ReadIndex].TicketId);
+            }
+            else
+            {
+                RatingIndex[WriteIndex++] = RatingIndex[ReadIndex];
+            }
+        }
+        RatingIndex.SetNum(WriteIndex);
+    }
+
+    if (ArrivalOrder.Num() != Tickets.Num())
+    {
+        ArrivalOrder.RemoveAll([this](int32 TicketId) { return !Tickets.Contains(TicketId); });
+    }
+
+    return NumMatches;
+}
+
+bool FSkillMatchmaker::GatherMatch(int32 AnchorIndex, double Window, const TBitArray<>& Matched, TArray<int32>& OutIndexes) const
+{
+    OutIndexes.Reset();
+    OutIndexes.Add(AnchorIndex);
+
+    const double AnchorRating = RatingIndex[AnchorIndex].Rating;
+    int32 Players = RatingIndex[AnchorIndex].PartySize;
+
+    int32 Left = AnchorIndex - 1;
+    int32 Right = AnchorIndex + 1;
+    int32 ScannedLeft = 0;
+    int32 ScannedRight = 0;
+
+    while (Players < Config.MatchSize)
+    {
+        while (Left >= 0 && Matched[Left] && ScannedLeft < Config.MaxScanPerSide)
+        {
+            Left--;
+            ScannedLeft++;
+        }
+        while (Right < RatingIndex.Num() && Matched[Right] && ScannedRight < Config.MaxScanPerSide)
+        {
+            Right++;
+            ScannedRight++;
+        }
+
+        const bool bLeftInWindow = Left >= 0 && ScannedLeft < Config.MaxScanPerSide && !Matched[Left]
+            && AnchorRating - RatingIndex[Left].Rating <= Window;
+        const bool bRightInWindow = Right < RatingIndex.Num() && ScannedRight < Config.MaxScanPerSide && !Matched[Right]
+            && RatingIndex[Right].Rating - AnchorRating <= Window;
+
+        if (!bLeftInWindow && !bRightInWindow)
+        {
+            return false;
+        }
+
+        // Closer rating wins
+        int32 Pick;
+        if (bLeftInWindow && (!bRightInWindow || AnchorRating - RatingIndex[Left].Rating <= RatingIndex[Right].Rating - AnchorRating))
+        {
+            Pick = Left--;
+            ScannedLeft++;
+        }
+        else
+        {
+            Pick = Right++;
+            ScannedRight++;
+        }
+
+        // Party does not fit into the slots left, keep looking
+        if (Players + RatingIndex[Pick].PartySize > Config.MatchSize)
+        {
+            continue;
+        }
+
+        Players += RatingIndex[Pick].PartySize;
+        OutIndexes.Add(Pick);
+    }
+
+    return true;
+}
+
+namespace
+{
+    // EasyMatchmaking.BenchmarkSkillMatchmaker [MaxTickets] - match pass cost as the queue grows
+    void BenchmarkSkillMatchmaker(const TArray<FString>& Args)
+    {
+        int32 MaxTickets = 16000;
+        if (Args.Num() > 0)
+        {
+            LexFromString(MaxTickets, *Args[0]);
+        }
+
+        FRandomStream Random(1337);
+        const double Now = 1000.0;
+
+        for (int32 NumTickets = 1000; NumTickets <= MaxTickets; NumTickets *= 2)
+        {
+            FSkillMatchmaker Matchmaker;
+
+            const double AddStart = FPlatformTime::Seconds();
+            for (int32 i = 0; i < NumTickets; i++)
+            {
+                // Roughly bell shaped around 1500, waited up to a minute
+                const double Rating = 1500.0 + (Random.FRand() + Random.FRand() + Random.FRand() - 1.5) * 800.0;
+                const int32 PartySize = Random.FRand() < 0.8f ? 1 : 2;
+                Matchmaker.AddTicket(FString(), Rating, PartySize, Now - Random.FRand() * 60.0);
+            }
+            const double AddMs = (FPlatformTime::Seconds() - AddStart) * 1000.0;
+
+            // First pass drains most of the queue, the second one is the steady state with leftovers
+            TArray<FSkillMatch> Matches;
+            const double PassStart = FPlatformTime::Seconds();
+            const int32 NumMatches = Matchmaker.RunMatchPass(Now, Matches);
+            const double PassMs = (FPlatformTime::Seconds() - PassStart) * 1000.0;
+
+            const int32 Leftover = Matchmaker.Num();
+            const double IdleStart = FPlatformTime::Seconds();
+            Matchmaker.RunMatchPass(Now, Matches);
+            const double IdlePassMs = (FPlatformTime::Seconds() - IdleStart) * 1000.0;
+
+            EM_LOG_INFO(TEXT("SkillMatchmaker %6d tickets: add %.3f ms, pass %.3f ms (%d matches), leftover pass %.3f ms (%d tickets)"),
+                NumTickets, AddMs, PassMs, NumMatches, IdlePassMs, Leftover);
+        }
+    }
+
+    FAutoConsoleCommand BenchmarkSkillMatchmakerCommand(
+        TEXT("EasyMatchmaking.BenchmarkSkillMatchmaker"),
+        TEXT("Times skill matchmaker passes for 1000 tickets and up, doubling to the given max (default 16000)"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkSkillMatchmaker));
+}
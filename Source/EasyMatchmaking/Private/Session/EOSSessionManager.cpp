@@ -1,8 +1,11 @@
 #include "Session/EOSSessionManager.h"
+#include "Async/EOSOperationRunner.h"
 #include "EOSLobbyManager.h"
 #include "EOSManager.h"
 #include "EasyMatchmakingLog.h"
 #include "IEOSSDKManager.h"
+#include "Lobby/LobbySummary.h"
+#include "Matchmaking/RegionLatency.h"
 
 #include "GameFramework/Character.h"  
 #include "GameFramework/GameModeBase.h"
@@ -51,22 +54,39 @@ void UEOSSessionManager::BeginDestroy()
     Super::BeginDestroy();
 }
 
-void UEOSSessionManager::DestroySession()
+int32 UEOSSessionManager::DestroySession()
 {
+    const int32 RequestId = NextOperationRequestId++;
     if (!SessionHandle || CurrentSessionId.IsEmpty())
     {
         EM_LOG_WARNING(TEXT("No active session to destroy"));
-        return;
+        OnSessionOperationComplete.Broadcast(ESessionOperation::Destroy, EOS_EResult::EOS_NotFound, CurrentSessionId, RequestId);
+        return RequestId;
     }
 
-    EOS_Sessions_DestroySessionOptions DestroyOptions = {};
-    DestroyOptions.ApiVersion = EOS_SESSIONS_DESTROYSESSION_API_LATEST;
-
-    FTCHARToUTF8 SessionIdConverter(*CurrentSessionId);
-    DestroyOptions.SessionName = SessionIdConverter.Get();
+    if (DestroyRequestId != 0)
+    {
+        EM_LOG_WARNING(TEXT("Session is already being destroyed"));
+        OnSessionOperationComplete.Broadcast(ESessionOperation::Destroy, EOS_EResult::EOS_AlreadyPending, CurrentSessionId, RequestId);
+        return RequestId;
+    }
 
     EM_LOG_INFO(TEXT("Destroying session: %s"), *CurrentSessionId);
-    EOS_Sessions_DestroySession(SessionHandle, &DestroyOptions, this, OnDestroySessionComplete);
+    DestroyRequestId = RequestId;
+    EOSOperationRunner::Run(EOSOperations::DestroySession, EOSManager->GetCircuitBreaker(), this, this,
+        [this, SessionName = CurrentSessionId](void* OperationData, EOS_Sessions_OnDestroySessionCallback Callback)
+        {
+            EOS_Sessions_DestroySessionOptions DestroyOptions = {};
+            DestroyOptions.ApiVersion = EOS_SESSIONS_DESTROYSESSION_API_LATEST;
+
+            FTCHARToUTF8 SessionIdConverter(*SessionName);
+            DestroyOptions.SessionName = SessionIdConverter.Get();
+
+            EOS_Sessions_DestroySession(SessionHandle, &DestroyOptions, OperationData, Callback);
+            return true;
+        },
+        OnDestroySessionComplete);
+    return RequestId;
 }
 
 void UEOSSessionManager::JoinSessionById(const FString& SessionId)
@@ -74,17 +94,25 @@ void UEOSSessionManager::JoinSessionById(const FString& SessionId)
     if (!SessionHandle || !LocalUserId)
     {
         EM_LOG_ERROR(TEXT("Cannot join session - invalid handles"));
+        OnSessionOperationComplete.Broadcast(ESessionOperation::Join, EOS_EResult::EOS_InvalidUser, SessionId, 0);
         return;
     }
 
     if (SessionId.IsEmpty())
     {
         EM_LOG_ERROR(TEXT("Session ID is empty!"));
+        OnSessionOperationComplete.Broadcast(ESessionOperation::Join, EOS_EResult::EOS_InvalidParameters, SessionId, 0);
         return;
     }
 
     EM_LOG_INFO(TEXT("Executing join Session By ID"));
 
+    // A join for another session travels on its own again
+    if (EarlyTravelSessionId != SessionId)
+    {
+        EarlyTravelSessionId.Empty();
+    }
+
     // Check if we already have this session cached from SearchSessions(), if you dont do it then callback possibli will not be executed :(
     EOS_HSessionDetails* CachedDetails = CachedSessionDetails.Find(SessionId);
     if (CachedDetails && *CachedDetails)
@@ -92,16 +120,22 @@ void UEOSSessionManager::JoinSessionById(const FString& SessionId)
         // Use cached details directly - no need for another search!
         EM_LOG_INFO(TEXT("Using cached session details for join"));
 
-        EOS_Sessions_JoinSessionOptions JoinOptions = {};
-        JoinOptions.ApiVersion = EOS_SESSIONS_JOINSESSION_API_LATEST;
-        JoinOptions.SessionHandle = *CachedDetails;
-        JoinOptions.LocalUserId = LocalUserId;
-        JoinOptions.bPresenceEnabled = EOS_FALSE;
-        JoinOptions.SessionName = "MyGameSession";
-
         PendingJoinSessionId = SessionId;
 
-        EOS_Sessions_JoinSession(SessionHandle, &JoinOptions, this, OnJoinSessionComplete);
+        EOSOperationRunner::Run(EOSOperations::JoinSession, EOSManager->GetCircuitBreaker(), this, this,
+            [this, SessionDetails = *CachedDetails](void* OperationData, EOS_Sessions_OnJoinSessionCallback Callback)
+            {
+                EOS_Sessions_JoinSessionOptions JoinOptions = {};
+                JoinOptions.ApiVersion = EOS_SESSIONS_JOINSESSION_API_LATEST;
+                JoinOptions.SessionHandle = SessionDetails;
+                JoinOptions.LocalUserId = LocalUserId;
+                JoinOptions.bPresenceEnabled = EOS_FALSE;
+                JoinOptions.SessionName = "MyGameSession";
+
+                EOS_Sessions_JoinSession(SessionHandle, &JoinOptions, OperationData, Callback);
+                return true;
+            },
+            OnJoinSessionComplete);
         return;
     }
 
@@ -136,20 +170,51 @@ void UEOSSessionManager::JoinSessionById(const FString& SessionId)
         EOS_SessionSearch_SetSessionId(CurrentSessionSearchHandle, &SetIdOptions);
 
         // Execute search - this will call OnFindSessionComplete
-        EOS_SessionSearch_FindOptions FindOptions = {};
-        FindOptions.ApiVersion = EOS_SESSIONSEARCH_FIND_API_LATEST;
-        FindOptions.LocalUserId = LocalUserId;
+        EOSOperationRunner::Run(EOSOperations::FindSessions, EOSManager->GetCircuitBreaker(), this, this,
+            [this, SearchHandle = CurrentSessionSearchHandle](void* OperationData, EOS_SessionSearch_OnFindCallback Callback)
+            {
+                // Replaced by a newer search, that one is the one we wait for
+                if (CurrentSessionSearchHandle != SearchHandle)
+                {
+                    return false;
+                }
 
-        EOS_SessionSearch_Find(CurrentSessionSearchHandle, &FindOptions, this, OnFindSessionComplete);
+                EOS_SessionSearch_FindOptions FindOptions = {};
+                FindOptions.ApiVersion = EOS_SESSIONSEARCH_FIND_API_LATEST;
+                FindOptions.LocalUserId = LocalUserId;
+
+                EOS_SessionSearch_Find(SearchHandle, &FindOptions, OperationData, Callback);
+                return true;
+            },
+            OnFindSessionComplete);
     }
     else
     {
         EM_LOG_ERROR(TEXT("Failed to create session search: %s"),
             UTF8_TO_TCHAR(EOS_EResult_ToString(Result)));
         PendingJoinSessionId.Empty();
+        OnSessionOperationComplete.Broadcast(ESessionOperation::Join, Result, SessionId, 0);
     }
 }
 
+void UEOSSessionManager::JoinSessionAtAddress(const FString& SessionId, const FString& ServerAddress)
+{
+    if (SessionId.IsEmpty() || ServerAddress.IsEmpty())
+    {
+        JoinSessionById(SessionId);
+        return;
+    }
+
+    if (EarlyTravelSessionId != SessionId)
+    {
+        EM_LOG_INFO(TEXT("Server of session %s known from the lobby, traveling before the session join"), *SessionId);
+        EarlyTravelSessionId = SessionId;
+        TravelToServer(ServerAddress);
+    }
+
+    JoinSessionById(SessionId);
+}
+
 void UEOSSessionManager::InitServer()
 {
     if (GEngine)
@@ -170,27 +235,39 @@ void UEOSSessionManager::InitServer()
     }
 }
 
-void UEOSSessionManager::CreateSession(const FString& SessionName, int32 MaxPlayers)
+int32 UEOSSessionManager::CreateSession(const FString& SessionName, int32 MaxPlayers)
 {
+    const int32 RequestId = NextOperationRequestId++;
+
     // Check if EOS SDK Manager is ready
     IEOSSDKManager* SDKManager = IEOSSDKManager::Get();
     if (!SDKManager || !SDKManager->IsInitialized())
     {
         EM_LOG_ERROR(TEXT("EOS SDK Manager not available or not initialized"));
-        return;
+        OnSessionOperationComplete.Broadcast(ESessionOperation::Create, EOS_EResult::EOS_NotConfigured, FString(), RequestId);
+        return RequestId;
 	}
 
     if (!SessionHandle)
     {
         EM_LOG_ERROR(TEXT("Cannot create session - invalid handles"));
-        return;
+        OnSessionOperationComplete.Broadcast(ESessionOperation::Create, EOS_EResult::EOS_InvalidState, FString(), RequestId);
+        return RequestId;
     }
 
     // For dedicated servers, LocalUserId can be null
     if (!IsRunningDedicatedServer() && !LocalUserId)
     {
         EM_LOG_ERROR(TEXT("Cannot create session - user not authenticated (client build)"));
-        return;
+        OnSessionOperationComplete.Broadcast(ESessionOperation::Create, EOS_EResult::EOS_InvalidUser, FString(), RequestId);
+        return RequestId;
+    }
+
+    if (CreateRequestId != 0)
+    {
+        EM_LOG_WARNING(TEXT("A session is already being created"));
+        OnSessionOperationComplete.Broadcast(ESessionOperation::Create, EOS_EResult::EOS_AlreadyPending, FString(), RequestId);
+        return RequestId;
     }
 
     // Create session modification
@@ -207,19 +284,57 @@ void UEOSSessionManager::CreateSession(const FString& SessionName, int32 MaxPlay
 
     if (Result == EOS_EResult::EOS_Success)
     {
-        // Update session to create it
-        EOS_Sessions_UpdateSessionOptions UpdateOptions = {};
-        UpdateOptions.ApiVersion = EOS_SESSIONS_UPDATESESSION_API_LATEST;
-        UpdateOptions.SessionModificationHandle = SessionModHandle;
+        // Advertise the region so clients can rank servers by latency
+        const FString Region = RegionLatency::GetServerRegion();
+        if (!Region.IsEmpty())
+        {
+            FTCHARToUTF8 RegionConverter(*Region);
+
+            EOS_Sessions_AttributeData RegionAttribute = {};
+            RegionAttribute.ApiVersion = EOS_SESSIONS_ATTRIBUTEDATA_API_LATEST;
+            RegionAttribute.Key = LobbyAttributeKeys::RegionUtf8;
+            RegionAttribute.Value.AsUtf8 = RegionConverter.Get();
+            RegionAttribute.ValueType = EOS_ESessionAttributeType::EOS_SAT_String;
+
+            EOS_SessionModification_AddAttributeOptions AttributeOptions = {};
+            AttributeOptions.ApiVersion = EOS_SESSIONMODIFICATION_ADDATTRIBUTE_API_LATEST;
+            AttributeOptions.SessionAttribute = &RegionAttribute;
+            AttributeOptions.AdvertisementType = EOS_ESessionAttributeAdvertisementType::EOS_SAAT_Advertise;
+
+            const EOS_EResult AttributeResult = EOS_SessionModification_AddAttribute(SessionModHandle, &AttributeOptions);
+            if (AttributeResult == EOS_EResult::EOS_Success)
+            {
+                EM_LOG_INFO(TEXT("Session region: %s"), *Region);
+            }
+            else
+            {
+                EM_LOG_WARNING(TEXT("Failed to add session region: %s"), UTF8_TO_TCHAR(EOS_EResult_ToString(AttributeResult)));
+            }
+        }
+
+        // Update session to create it, the modification is kept until the update is answered
+        TSharedRef<TEOSHandleGuard<EOS_HSessionModification>> Modification =
+            MakeShared<TEOSHandleGuard<EOS_HSessionModification>>(SessionModHandle, &EOS_SessionModification_Release);
+        CreateRequestId = RequestId;
+        EOSOperationRunner::Run(EOSOperations::CreateSession, EOSManager->GetCircuitBreaker(), this, this,
+            [this, Modification](void* OperationData, EOS_Sessions_OnUpdateSessionCallback Callback)
+            {
+                EOS_Sessions_UpdateSessionOptions UpdateOptions = {};
+                UpdateOptions.ApiVersion = EOS_SESSIONS_UPDATESESSION_API_LATEST;
+                UpdateOptions.SessionModificationHandle = Modification->Handle;
 
-        EOS_Sessions_UpdateSession(SessionHandle, &UpdateOptions, this, OnCreateSessionComplete);
-        EOS_SessionModification_Release(SessionModHandle);
+                EOS_Sessions_UpdateSession(SessionHandle, &UpdateOptions, OperationData, Callback);
+                return true;
+            },
+            OnCreateSessionComplete);
     }
     else
     {
         EM_LOG_ERROR(TEXT("Failed to create session modification: %s"),
             UTF8_TO_TCHAR(EOS_EResult_ToString(Result)));
+        OnSessionOperationComplete.Broadcast(ESessionOperation::Create, Result, FString(), RequestId);
     }
+    return RequestId;
 }
 
 void UEOSSessionManager::SearchSessions(const FString& BucketId)
@@ -227,6 +342,7 @@ void UEOSSessionManager::SearchSessions(const FString& BucketId)
     if (!SessionHandle || !LocalUserId)
     {
         EM_LOG_ERROR(TEXT("Cannot search sessions - invalid handles"));
+        OnSessionOperationComplete.Broadcast(ESessionOperation::Search, EOS_EResult::EOS_InvalidUser, FString(), 0);
         return;
     }
 
@@ -255,12 +371,28 @@ void UEOSSessionManager::SearchSessions(const FString& BucketId)
         EOS_SessionSearch_SetParameter(CurrentSessionSearchHandle, &SetParamOptions);
 
         // Execute search
-        EOS_SessionSearch_FindOptions FindOptions = {};
-        FindOptions.ApiVersion = EOS_SESSIONSEARCH_FIND_API_LATEST;
-        FindOptions.LocalUserId = LocalUserId;
-
         EM_LOG_INFO(TEXT("Searching for sessions..."));
-        EOS_SessionSearch_Find(CurrentSessionSearchHandle, &FindOptions, this, OnSessionSearchComplete);
+        EOSOperationRunner::Run(EOSOperations::FindSessions, EOSManager->GetCircuitBreaker(), this, this,
+            [this, SearchHandle = CurrentSessionSearchHandle](void* OperationData, EOS_SessionSearch_OnFindCallback Callback)
+            {
+                if (CurrentSessionSearchHandle != SearchHandle)
+                {
+                    return false;
+                }
+
+                EOS_SessionSearch_FindOptions FindOptions = {};
+                FindOptions.ApiVersion = EOS_SESSIONSEARCH_FIND_API_LATEST;
+                FindOptions.LocalUserId = LocalUserId;
+
+                EOS_SessionSearch_Find(SearchHandle, &FindOptions, OperationData, Callback);
+                return true;
+            },
+            OnSessionSearchComplete);
+    }
+    else
+    {
+        EM_LOG_ERROR(TEXT("Failed to create session search: %s"), UTF8_TO_TCHAR(EOS_EResult_ToString(Result)));
+        OnSessionOperationComplete.Broadcast(ESessionOperation::Search, Result, FString(), 0);
     }
 }
 
@@ -286,6 +418,7 @@ void UEOSSessionManager::OnSessionSearchComplete(const EOS_SessionSearch_FindCal
         }
     }
     SessionManager->CachedSessionDetails.Empty();
+    SessionManager->SessionLatencies.Empty();
 
     if (Data->ResultCode == EOS_EResult::EOS_Success)
     {
@@ -331,6 +464,8 @@ void UEOSSessionManager::OnSessionSearchComplete(const EOS_SessionSearch_FindCal
             }
         }
 
+        SessionManager->SortSessionsByLatency(FoundSessionIds);
+
         // Broadcast found sessions to Blueprint
         SessionManager->OnSessionsFound.Broadcast(FoundSessionIds);
     }
@@ -342,6 +477,8 @@ void UEOSSessionManager::OnSessionSearchComplete(const EOS_SessionSearch_FindCal
         EOS_SessionSearch_Release(SessionManager->CurrentSessionSearchHandle);
         SessionManager->CurrentSessionSearchHandle = nullptr;
     }
+
+    SessionManager->OnSessionOperationComplete.Broadcast(ESessionOperation::Search, Data->ResultCode, FString(), 0);
 }
 
 void UEOSSessionManager::OnFindSessionComplete(const EOS_SessionSearch_FindCallbackInfo* Data)
@@ -384,6 +521,7 @@ void UEOSSessionManager::OnFindSessionComplete(const EOS_SessionSearch_FindCallb
             {
                 EM_LOG_ERROR(TEXT("No server address in session"));
                 EOS_SessionDetails_Release(SessionDetails);
+                SessionManager->OnSessionOperationComplete.Broadcast(ESessionOperation::Join, EOS_EResult::EOS_InvalidState, SessionId, 0);
                 return;
             }
             EM_LOG_INFO(TEXT("Found server at: %s"), *ServerAddress);
@@ -398,22 +536,25 @@ void UEOSSessionManager::OnFindSessionComplete(const EOS_SessionSearch_FindCallb
 
             EM_LOG_INFO(TEXT("Joining session..."));
 
-            EOS_Sessions_JoinSession(
-                SessionManager->SessionHandle,
-                &JoinOptions,
-                SessionManager,
-                OnJoinSessionComplete
-            );
+            EOSOperationRunner::Run(EOSOperations::JoinSession, SessionManager->EOSManager->GetCircuitBreaker(), SessionManager, SessionManager,
+                [SessionManager, JoinOptions](void* OperationData, EOS_Sessions_OnJoinSessionCallback Callback)
+                {
+                    EOS_Sessions_JoinSession(SessionManager->SessionHandle, &JoinOptions, OperationData, Callback);
+                    return true;
+                },
+                OnJoinSessionComplete);
         }
         else
         {
             EM_LOG_ERROR(TEXT("Failed to get session details from search"));
+            SessionManager->OnSessionOperationComplete.Broadcast(ESessionOperation::Join, EOS_EResult::EOS_NotFound, SessionManager->PendingJoinSessionId, 0);
         }
     }
     else
     {
         EM_LOG_ERROR(TEXT("Session search failed: %s"),
             UTF8_TO_TCHAR(EOS_EResult_ToString(Data->ResultCode)));
+        SessionManager->OnSessionOperationComplete.Broadcast(ESessionOperation::Join, Data->ResultCode, SessionManager->PendingJoinSessionId, 0);
     }
 }
 
@@ -427,6 +568,7 @@ void UEOSSessionManager::OnJoinSessionComplete(const EOS_Sessions_JoinSessionCal
     }
 
     EM_LOG_INFO(TEXT("=== OnJoinSessionComplete executed ==="));
+    const FString JoiningSessionId = SessionManager->PendingJoinSessionId;
 
     if (Data->ResultCode == EOS_EResult::EOS_Success)
     {
@@ -434,13 +576,16 @@ void UEOSSessionManager::OnJoinSessionComplete(const EOS_Sessions_JoinSessionCal
         if (SessionId.IsEmpty())
         {
             EM_LOG_ERROR(TEXT("No session ID stored!"));
+            SessionManager->OnSessionOperationComplete.Broadcast(ESessionOperation::Join, EOS_EResult::EOS_InvalidState, SessionId, 0);
             return;
         }
 
         EM_LOG_INFO(TEXT("Joined session successfully, Session ID: %s"), *SessionId);
         SessionManager->CurrentSessionId = SessionId;
 
-        // If in a lobby, share the Session ID (NOT IP!)
+        EOS_HSessionDetails* SessionDetailsPtr = SessionManager->CachedSessionDetails.Find(SessionId);
+
+        // If in a lobby, share the Session ID (NOT IP!) and the server it resolved to, so members can travel without searching
         if (SessionManager->EOSManager)
         {
             if (UEOSLobbyManager* LobbyManager = SessionManager->EOSManager->GetLobbyManager())
@@ -449,6 +594,10 @@ void UEOSSessionManager::OnJoinSessionComplete(const EOS_Sessions_JoinSessionCal
                 {
                     if (LobbyManager->IsLobbyOwner())
                     {
+                        if (SessionDetailsPtr && *SessionDetailsPtr)
+                        {
+                            LobbyManager->SetLobbySessionServer(SessionManager->MakeSessionServer(SessionId, *SessionDetailsPtr));
+                        }
                         LobbyManager->SetLobbySessionAddress(SessionId);
                         EM_LOG_INFO(TEXT("[OWNER] Shared Session ID with lobby: %s"), *SessionId);
                     }
@@ -468,42 +617,35 @@ void UEOSSessionManager::OnJoinSessionComplete(const EOS_Sessions_JoinSessionCal
             EM_LOG_ERROR(TEXT("Cant get EOSmanager in order set adress!"));
         }
 
-        EOS_HSessionDetails* SessionDetailsPtr = SessionManager->CachedSessionDetails.Find(SessionId);
-        EM_LOG_INFO(TEXT("Checking CACHED DETAILS"));
-        if (SessionDetailsPtr && *SessionDetailsPtr)
+        if (SessionManager->EarlyTravelSessionId == SessionId)
         {
-            FString ServerAddress = SessionManager->GetServerAddressFromSessionDetails(*SessionDetailsPtr);
-
-            if (!ServerAddress.IsEmpty())
+            EM_LOG_INFO(TEXT("Already traveling to the server, session registered"));
+        }
+        else
+        {
+            EM_LOG_INFO(TEXT("Checking CACHED DETAILS"));
+            if (SessionDetailsPtr && *SessionDetailsPtr)
             {
-                if (UWorld* World = GEngine->GetWorldFromContextObject(SessionManager, EGetWorldErrorMode::LogAndReturnNull))
+                FString ServerAddress = SessionManager->GetServerAddressFromSessionDetails(*SessionDetailsPtr);
+
+                if (!ServerAddress.IsEmpty())
                 {
-                    APlayerController* PC = World->GetFirstPlayerController();
-                    if (PC)
-                    {
-                        // Clear UI input mode
-                        FInputModeGameOnly InputMode;
-                        PC->SetInputMode(InputMode);
-                        PC->SetShowMouseCursor(false);
-
-                        // Travel to server
-                        PC->ClientTravel(ServerAddress, TRAVEL_Absolute);
-                        EM_LOG_INFO(TEXT("Traveling to server: %s"), *ServerAddress);
-                    }
+                    SessionManager->TravelToServer(ServerAddress);
+                }
+                else
+                {
+                    EM_LOG_ERROR(TEXT("No server address found in session"));
                 }
             }
             else
             {
-                EM_LOG_ERROR(TEXT("No server address found in session"));
+                EM_LOG_ERROR(TEXT("No CachedSessionDetails"));
             }
         }
-        else
-        {
-            EM_LOG_ERROR(TEXT("No CachedSessionDetails"));
-        }
 
         // Clear pending ID
         SessionManager->PendingJoinSessionId.Empty();
+        SessionManager->EarlyTravelSessionId.Empty();
     }
     else if (Data->ResultCode == EOS_EResult::EOS_Sessions_SessionAlreadyExists) // For production with real players, this error shouldn't happen because each player has a unique account. 
     {
@@ -516,34 +658,29 @@ void UEOSSessionManager::OnJoinSessionComplete(const EOS_Sessions_JoinSessionCal
         // Still get server address and travel
         EOS_HSessionDetails* SessionDetailsPtr = SessionManager->CachedSessionDetails.Find(SessionId);
 
-        if (SessionDetailsPtr && *SessionDetailsPtr)
+        if (SessionManager->EarlyTravelSessionId != SessionId && SessionDetailsPtr && *SessionDetailsPtr)
         {
             FString ServerAddress = SessionManager->GetServerAddressFromSessionDetails(*SessionDetailsPtr);
 
             if (!ServerAddress.IsEmpty())
             {
-                if (UWorld* World = GEngine->GetWorldFromContextObject(SessionManager, EGetWorldErrorMode::LogAndReturnNull))
-                {
-                    APlayerController* PC = World->GetFirstPlayerController();
-                    if (PC)
-                    {
-                        FInputModeGameOnly InputMode;
-                        PC->SetInputMode(InputMode);
-                        PC->SetShowMouseCursor(false);
-
-                        PC->ClientTravel(ServerAddress, TRAVEL_Absolute);
-                        EM_LOG_INFO(TEXT("Traveling anyway: %s"), *ServerAddress);
-                    }
-                }
+                SessionManager->TravelToServer(ServerAddress);
             }
         }
 
         SessionManager->PendingJoinSessionId.Empty();
+        SessionManager->EarlyTravelSessionId.Empty();
     }
     else
     {
         EM_LOG_ERROR(TEXT("Failed to join session: %s"),
             UTF8_TO_TCHAR(EOS_EResult_ToString(Data->ResultCode)));
+
+        if (SessionManager->EarlyTravelSessionId == JoiningSessionId)
+        {
+            // Travel is on its way already, a retry only has to register us with the session
+            EM_LOG_WARNING(TEXT("Traveled to the server but could not register with session %s"), *JoiningSessionId);
+        }
     }
 
     //Clean up all cached session details after join attempt
@@ -555,6 +692,58 @@ void UEOSSessionManager::OnJoinSessionComplete(const EOS_Sessions_JoinSessionCal
         }
     }
     SessionManager->CachedSessionDetails.Empty();
+
+    SessionManager->OnSessionOperationComplete.Broadcast(ESessionOperation::Join, Data->ResultCode, JoiningSessionId, 0);
+}
+
+void UEOSSessionManager::TravelToServer(const FString& ServerAddress)
+{
+    if (UWorld* World = GEngine->GetWorldFromContextObject(this, EGetWorldErrorMode::LogAndReturnNull))
+    {
+        APlayerController* PC = World->GetFirstPlayerController();
+        if (PC)
+        {
+            // Clear UI input mode
+            FInputModeGameOnly InputMode;
+            PC->SetInputMode(InputMode);
+            PC->SetShowMouseCursor(false);
+
+            // The server queues players by this rating, see AEasyMatchmakingServerGameMode
+            FString TravelURL = ServerAddress;
+            UEOSLobbyManager* LobbyManager = EOSManager ? EOSManager->GetLobbyManager() : nullptr;
+            if (LobbyManager && LobbyManager->GetPlayerRating().IsSet())
+            {
+                TravelURL += FString::Printf(TEXT("?Rating=%.2f"), LobbyManager->GetPlayerRating().GetValue());
+            }
+
+            // Travel to server
+            PC->ClientTravel(TravelURL, TRAVEL_Absolute);
+            EM_LOG_INFO(TEXT("Traveling to server: %s"), *TravelURL);
+        }
+    }
+}
+
+FLobbySessionServer UEOSSessionManager::MakeSessionServer(const FString& SessionId, EOS_HSessionDetails SessionDetails)
+{
+    FLobbySessionServer Server;
+    Server.SessionId = SessionId;
+    Server.ServerAddress = GetServerAddressFromSessionDetails(SessionDetails);
+    Server.Region = GetSessionRegion(SessionDetails);
+
+    EOS_SessionDetails_CopyInfoOptions InfoOptions = {};
+    InfoOptions.ApiVersion = EOS_SESSIONDETAILS_COPYINFO_API_LATEST;
+
+    EOS_SessionDetails_Info* SessionInfo = nullptr;
+    if (EOS_SessionDetails_CopyInfo(SessionDetails, &InfoOptions, &SessionInfo) == EOS_EResult::EOS_Success)
+    {
+        if (SessionInfo->Settings && SessionInfo->Settings->BucketId)
+        {
+            Server.BucketId = UTF8_TO_TCHAR(SessionInfo->Settings->BucketId);
+        }
+        EOS_SessionDetails_Info_Release(SessionInfo);
+    }
+
+    return Server;
 }
 
 FString UEOSSessionManager::GetServerAddressFromSessionDetails(EOS_HSessionDetails SessionDetails)
@@ -568,7 +757,7 @@ FString UEOSSessionManager::GetServerAddressFromSessionDetails(EOS_HSessionDetai
     FString HostIP;
     int32 Port = 7777; // Default port
 
-    // Get session info
+    // The only address of the session, it is the server in the region the session advertises (see header)
     EOS_SessionDetails_CopyInfoOptions InfoOptions = {};
     InfoOptions.ApiVersion = EOS_SESSIONDETAILS_COPYINFO_API_LATEST;
 
@@ -596,20 +785,95 @@ FString UEOSSessionManager::GetServerAddressFromSessionDetails(EOS_HSessionDetai
         return TEXT("127.0.0.1:7777");
     }
 
+    const FString Region = GetSessionRegion(SessionDetails);
+
     // Check if already has port
     if (HostIP.Contains(TEXT(":")))
     {
-        EM_LOG_INFO(TEXT("Server address: %s"), *HostIP);
+        EM_LOG_INFO(TEXT("Server address: %s (region %s)"), *HostIP, Region.IsEmpty() ? TEXT("unknown") : *Region);
         return HostIP;
     }
 
     // If no then Add port
     FString FullAddress = FString::Printf(TEXT("%s:%d"), *HostIP, Port);
-    EM_LOG_INFO(TEXT("Server address with port: %s"), *FullAddress);
+    EM_LOG_INFO(TEXT("Server address with port: %s (region %s)"), *FullAddress, Region.IsEmpty() ? TEXT("unknown") : *Region);
 
     return FullAddress;
 }
 
+FString UEOSSessionManager::GetSessionRegion(EOS_HSessionDetails SessionDetails) const
+{
+    EOS_SessionDetails_CopySessionAttributeByKeyOptions AttributeOptions = {};
+    AttributeOptions.ApiVersion = EOS_SESSIONDETAILS_COPYSESSIONATTRIBUTEBYKEY_API_LATEST;
+    AttributeOptions.AttrKey = LobbyAttributeKeys::RegionUtf8;
+
+    FString Region;
+    EOS_SessionDetails_Attribute* Attribute = nullptr;
+    if (EOS_SessionDetails_CopySessionAttributeByKey(SessionDetails, &AttributeOptions, &Attribute) == EOS_EResult::EOS_Success && Attribute)
+    {
+        if (Attribute->Data && Attribute->Data->ValueType == EOS_ESessionAttributeType::EOS_SAT_String && Attribute->Data->Value.AsUtf8)
+        {
+            Region = UTF8_TO_TCHAR(Attribute->Data->Value.AsUtf8);
+        }
+        EOS_SessionDetails_Attribute_Release(Attribute);
+    }
+    return Region;
+}
+
+void UEOSSessionManager::SortSessionsByLatency(TArray<FString>& SessionIds)
+{
+    const TMap<FString, int32> NoLatencies;
+    const TMap<FString, int32>& Latencies = EOSManager ? EOSManager->GetRegionLatencyMap() : NoLatencies;
+    if (Latencies.Num() == 0)
+    {
+        return;
+    }
+
+    for (const FString& SessionId : SessionIds)
+    {
+        const EOS_HSessionDetails* SessionDetails = CachedSessionDetails.Find(SessionId);
+        if (SessionDetails && *SessionDetails)
+        {
+            SessionLatencies.Add(SessionId, RegionLatency::Find(Latencies, GetSessionRegion(*SessionDetails)));
+        }
+    }
+
+    // Unknown region last, they might be close or not
+    auto SortKey = [this](const FString& SessionId)
+    {
+        const int32 Latency = GetSessionLatency(SessionId);
+        return Latency < 0 ? MAX_int32 : Latency;
+    };
+    SessionIds.StableSort([&SortKey](const FString& A, const FString& B) { return SortKey(A) < SortKey(B); });
+
+    // A search is one shot, so the cap widens once instead of over time
+    const UEasyMatchmakingSettings* Settings = UEasyMatchmakingSettings::Get();
+    for (const int32 Cap : { Settings->MaxLatencyMs, FMath::Max(Settings->MaxLatencyMs, Settings->MaxWidenedLatencyMs) })
+    {
+        if (Cap <= 0)
+        {
+            return;
+        }
+
+        // Unknown regions stay, but only known ones within the cap count as a hit
+        bool bAnyKnownWithinCap = false;
+        TArray<FString> WithinCap = SessionIds.FilterByPredicate([this, Cap, &bAnyKnownWithinCap](const FString& SessionId)
+        {
+            const int32 Latency = GetSessionLatency(SessionId);
+            bAnyKnownWithinCap |= Latency >= 0 && Latency <= Cap;
+            return Latency <= Cap;
+        });
+        if (bAnyKnownWithinCap)
+        {
+            EM_LOG_INFO(TEXT("%d of %d sessions within %d ms"), WithinCap.Num(), SessionIds.Num(), Cap);
+            SessionIds = MoveTemp(WithinCap);
+            return;
+        }
+    }
+
+    EM_LOG_WARNING(TEXT("No session within %d ms, keeping all of them"), Settings->MaxWidenedLatencyMs);
+}
+
 void UEOSSessionManager::OnCreateSessionComplete(const EOS_Sessions_UpdateSessionCallbackInfo* Data)
 {
     UEOSSessionManager* SessionManager = static_cast<UEOSSessionManager*>(Data->ClientData);
@@ -625,6 +889,15 @@ void UEOSSessionManager::OnCreateSessionComplete(const EOS_Sessions_UpdateSessio
         SessionManager->CurrentSessionId = UTF8_TO_TCHAR(Data->SessionId);
         EM_LOG_INFO(TEXT("Session created successfully! SessionId: %s"), *SessionManager->CurrentSessionId);
     }
+    else
+    {
+        EM_LOG_ERROR(TEXT("Failed to create session: %s"), UTF8_TO_TCHAR(EOS_EResult_ToString(Data->ResultCode)));
+    }
+
+    const int32 RequestId = SessionManager->CreateRequestId;
+    SessionManager->CreateRequestId = 0;
+    SessionManager->OnSessionOperationComplete.Broadcast(ESessionOperation::Create, Data->ResultCode,
+        Data->ResultCode == EOS_EResult::EOS_Success ? SessionManager->CurrentSessionId : FString(), RequestId);
 }
 
 void UEOSSessionManager::OnDestroySessionComplete(const EOS_Sessions_DestroySessionCallbackInfo* Data)
@@ -646,5 +919,9 @@ void UEOSSessionManager::OnDestroySessionComplete(const EOS_Sessions_DestroySess
         EM_LOG_ERROR(TEXT("Failed to destroy session: %s"),
             UTF8_TO_TCHAR(EOS_EResult_ToString(Data->ResultCode)));
     }
+
+    const int32 RequestId = SessionManager->DestroyRequestId;
+    SessionManager->DestroyRequestId = 0;
+    SessionManager->OnSessionOperationComplete.Broadcast(ESessionOperation::Destroy, Data->ResultCode, FString(), RequestId);
 }
 
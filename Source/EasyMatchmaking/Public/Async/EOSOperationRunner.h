@@ -0,0 +1,237 @@
+#pragma once
+
+#include <eos_common.h>
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+
+// Backend interface an operation talks to, each one has its own circuit breaker
+enum class EEOSService : uint8
+{
+    Lobby,
+    Sessions,
+    Auth,
+    Connect,
+    UserInfo,
+    Num
+};
+
+struct FEOSOperationDesc
+{
+    FEOSOperationDesc(const TCHAR* InName, EEOSService InService) : Name(InName), Service(InService) {}
+
+    FEOSOperationDesc& NotIdempotent() { bIdempotent = false; return *this; }
+    FEOSOperationDesc& NoResend() { bCanResend = false; return *this; }
+    FEOSOperationDesc& WaitsForUser() { bWaitsForUser = true; return *this; }
+    FEOSOperationDesc& DeadlineOnlyReports() { bDeadlineOnlyReports = true; return *this; }
+
+    // Key of the per-operation override in the settings (RetryPolicyOverrides)
+    const TCHAR* Name = TEXT("");
+    EEOSService Service = EEOSService::Lobby;
+    // A timed out create may still have gone through, those are only sent again when the backend said it did not take them
+    bool bIdempotent = true;
+    // False when the call uses a handle the caller owns and may release right after, it is never sent twice
+    bool bCanResend = true;
+    // Waits on the player (account portal login), has no deadline
+    bool bWaitsForUser = false;
+    // Makes the local user owner or member of something (or creates the account). A late success can't be thrown away,
+    // so the deadline only reports (OnTimedOut) and the caller keeps waiting for the real answer.
+    bool bDeadlineOnlyReports = false;
+};
+
+namespace EOSOperations
+{
+    inline const FEOSOperationDesc CreateLobby = FEOSOperationDesc(TEXT("CreateLobby"), EEOSService::Lobby).NotIdempotent().DeadlineOnlyReports();
+    inline const FEOSOperationDesc JoinLobby = FEOSOperationDesc(TEXT("JoinLobby"), EEOSService::Lobby).NoResend().DeadlineOnlyReports();
+    inline const FEOSOperationDesc JoinLobbyById = FEOSOperationDesc(TEXT("JoinLobbyById"), EEOSService::Lobby).DeadlineOnlyReports();
+    inline const FEOSOperationDesc LeaveLobby = FEOSOperationDesc(TEXT("LeaveLobby"), EEOSService::Lobby);
+    inline const FEOSOperationDesc DestroyLobby = FEOSOperationDesc(TEXT("DestroyLobby"), EEOSService::Lobby);
+    inline const FEOSOperationDesc UpdateLobby = FEOSOperationDesc(TEXT("UpdateLobby"), EEOSService::Lobby);
+    inline const FEOSOperationDesc FindLobbies = FEOSOperationDesc(TEXT("FindLobbies"), EEOSService::Lobby);
+    inline const FEOSOperationDesc CreateSession = FEOSOperationDesc(TEXT("CreateSession"), EEOSService::Sessions).NotIdempotent().DeadlineOnlyReports();
+    inline const FEOSOperationDesc JoinSession = FEOSOperationDesc(TEXT("JoinSession"), EEOSService::Sessions).NoResend().DeadlineOnlyReports();
+    inline const FEOSOperationDesc DestroySession = FEOSOperationDesc(TEXT("DestroySession"), EEOSService::Sessions);
+    inline const FEOSOperationDesc FindSessions = FEOSOperationDesc(TEXT("FindSessions"), EEOSService::Sessions);
+    inline const FEOSOperationDesc AuthLogin = FEOSOperationDesc(TEXT("AuthLogin"), EEOSService::Auth).NotIdempotent().WaitsForUser();
+    inline const FEOSOperationDesc ConnectLogin = FEOSOperationDesc(TEXT("ConnectLogin"), EEOSService::Connect);
+    inline const FEOSOperationDesc CreateUser = FEOSOperationDesc(TEXT("CreateUser"), EEOSService::Connect).NotIdempotent().DeadlineOnlyReports();
+    inline const FEOSOperationDesc QueryUserIdMappings = FEOSOperationDesc(TEXT("QueryUserIdMappings"), EEOSService::Connect);
+    inline const FEOSOperationDesc QueryUserInfo = FEOSOperationDesc(TEXT("QueryUserInfo"), EEOSService::UserInfo);
+}
+
+// Circuit breaker of every service for one game instance, UEOSManager owns it so PIE instances don't trip each other's
+class EASYMATCHMAKING_API FEOSCircuitBreaker
+{
+public:
+    bool IsOpen(EEOSService Service) const;
+    void Reset();
+
+private:
+    friend class FEOSOperation;
+
+    struct FState
+    {
+        int32 ConsecutiveFailures = 0;
+        // 0 while closed, once it is in the past the circuit is half open
+        double OpenUntil = 0.0;
+        bool bProbeInFlight = false;
+    };
+
+    FState& Get(EEOSService Service) { return States[static_cast<int32>(Service)]; }
+    const FState& Get(EEOSService Service) const { return States[static_cast<int32>(Service)]; }
+
+    FState States[static_cast<int32>(EEOSService::Num)];
+};
+
+// Keeps an EOS handle alive while an operation may still be sent again, released together with the operation
+template <typename THandle>
+struct TEOSHandleGuard
+{
+    using FRelease = void (EOS_CALL*)(THandle);
+
+    TEOSHandleGuard(THandle InHandle, FRelease InRelease) : Handle(InHandle), Release(InRelease) {}
+    ~TEOSHandleGuard() { if (Handle) { Release(Handle); } }
+    TEOSHandleGuard(const TEOSHandleGuard&) = delete;
+    TEOSHandleGuard& operator=(const TEOSHandleGuard&) = delete;
+
+    THandle Handle;
+    FRelease Release;
+};
+
+// One EOS async call with retries. The call is wrapped so our trampoline gets the callback first: transient failures
+// (timeouts, throttling, no connection) are sent again with exponential backoff and jitter, everything else goes to
+// the real callback with the caller's ClientData, as if EOS had called it directly.
+// Each call sent is tracked by FEOSOperationTracker: a call that misses its deadline gets EOS_TimedOut right away, its late
+// answer is dropped and it is not sent again, EOS may still be working on it. Creates and joins (bDeadlineOnlyReports)
+// are the exception, their deadline is only reported and the real answer still reaches the caller.
+// The circuit breaker of the service fails calls fast (EOS_ServiceFailure, next tick) after too many transient failures in a row,
+// and lets one call through after the cooldown to see if the backend is back.
+class EASYMATCHMAKING_API FEOSOperation
+{
+public:
+    virtual ~FEOSOperation();
+
+    // Worth sending again later. Not EOS_OperationWillRetry, EOS is already sending that one again.
+    static bool IsTransient(EOS_EResult Result);
+    // The backend did not take the request, safe to send again even if it is not idempotent
+    static bool IsNotProcessed(EOS_EResult Result);
+
+protected:
+    enum class EResultAction : uint8
+    {
+        Deliver,
+        // Sent again, the operation lives on
+        Retry,
+        // Answer came after the deadline, the caller already got EOS_TimedOut
+        Drop
+    };
+
+    FEOSOperation(const FEOSOperationDesc& InDesc, const TSharedRef<FEOSCircuitBreaker>& InCircuitBreaker, void* InClientData, const UObject* InOwner);
+
+    // Sends the call, false if it can't be sent (anymore)
+    virtual bool Issue() = 0;
+    // Calls the real callback with only the result set, used when EOS never answered
+    virtual void DeliverWithoutAnswer(EOS_EResult Result) = 0;
+
+    void Start();
+    EResultAction HandleResult(EOS_EResult Result);
+
+    FEOSOperationDesc Desc;
+    void* ClientData = nullptr;
+
+private:
+    void Send();
+    void ScheduleRetry(float Delay);
+    void FailWithoutSending(EOS_EResult Result);
+    void HandleDeadline();
+    // Counts the result towards the service's circuit breaker
+    void UpdateCircuit(EOS_EResult Result);
+
+    TSharedRef<FEOSCircuitBreaker> CircuitBreaker;
+    TWeakObjectPtr<const UObject> Owner;
+    bool bHasOwner = false;
+    int32 Attempt = 0;
+    uint64 TrackingId = 0;
+    double SentTime = 0.0;
+    bool bIsProbe = false;
+    bool bTimedOut = false;
+    EOS_EResult LastResult = EOS_EResult::EOS_Success;
+};
+
+template <typename TCallbackInfo>
+class TEOSOperation final : public FEOSOperation
+{
+public:
+    using FCallback = void (EOS_CALL*)(const TCallbackInfo*);
+    using FIssue = TUniqueFunction<bool(void* /*ClientData*/, FCallback /*Callback*/)>;
+
+    TEOSOperation(const FEOSOperationDesc& InDesc, const TSharedRef<FEOSCircuitBreaker>& InCircuitBreaker, void* InClientData, const UObject* InOwner,
+        FIssue&& InIssue, FCallback InCallback)
+        : FEOSOperation(InDesc, InCircuitBreaker, InClientData, InOwner)
+        , IssueCall(MoveTemp(InIssue))
+        , Callback(InCallback)
+    {
+    }
+
+    using FEOSOperation::Start;
+
+private:
+    virtual bool Issue() override
+    {
+        return IssueCall(this, &TEOSOperation::Trampoline);
+    }
+
+    virtual void DeliverWithoutAnswer(EOS_EResult Result) override
+    {
+        TCallbackInfo Info = {};
+        Info.ResultCode = Result;
+        Info.ClientData = ClientData;
+        Callback(&Info);
+    }
+
+    static void EOS_CALL Trampoline(const TCallbackInfo* Data)
+    {
+        // EOS_OperationWillRetry: EOS is sending it again itself and calls back with the same ClientData, wait for the final answer
+        if (!EOS_EResult_IsOperationComplete(Data->ResultCode))
+        {
+            return;
+        }
+
+        TEOSOperation* Operation = static_cast<TEOSOperation*>(Data->ClientData);
+        switch (Operation->HandleResult(Data->ResultCode))
+        {
+        case EResultAction::Retry:
+            return;
+        case EResultAction::Drop:
+            delete Operation;
+            return;
+        default:
+            break;
+        }
+
+        // Pointers in the info stay valid for the duration of this call
+        TCallbackInfo Info = *Data;
+        Info.ClientData = Operation->ClientData;
+        const FCallback RealCallback = Operation->Callback;
+        delete Operation;
+        RealCallback(&Info);
+    }
+
+    FIssue IssueCall;
+    FCallback Callback;
+};
+
+namespace EOSOperationRunner
+{
+    // Issue gets our ClientData and callback and has to pass them to the EOS call (it may be called again for a retry,
+    // so it builds its options from what it captured). Owner, if given, must still be alive for a retry to go out.
+    // CircuitBreaker is the one of the game instance making the call (UEOSManager::GetCircuitBreaker).
+    template <typename TCallbackInfo, typename TIssue>
+    void Run(const FEOSOperationDesc& Desc, const TSharedRef<FEOSCircuitBreaker>& CircuitBreaker, void* ClientData, const UObject* Owner,
+        TIssue&& Issue, void (EOS_CALL* Callback)(const TCallbackInfo*))
+    {
+        TEOSOperation<TCallbackInfo>* Operation = new TEOSOperation<TCallbackInfo>(Desc, CircuitBreaker, ClientData, Owner,
+            typename TEOSOperation<TCallbackInfo>::FIssue(Forward<TIssue>(Issue)), Callback);
+        Operation->Start();
+    }
+}
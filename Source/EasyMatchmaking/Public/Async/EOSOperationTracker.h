@@ -0,0 +1,124 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "EOSOperationTracker.generated.h"
+
+USTRUCT(BlueprintType)
+struct FEOSOperationStats
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "EasyMatchmaking|Diagnostics")
+    FString Operation;
+
+    // Calls EOS answered, retries count on their own
+    UPROPERTY(BlueprintReadOnly, Category = "EasyMatchmaking|Diagnostics")
+    int32 Count = 0;
+
+    // Answered with anything but success
+    UPROPERTY(BlueprintReadOnly, Category = "EasyMatchmaking|Diagnostics")
+    int32 Failures = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "EasyMatchmaking|Diagnostics")
+    int32 TimedOut = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "EasyMatchmaking|Diagnostics")
+    int32 InFlight = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "EasyMatchmaking|Diagnostics")
+    float AverageMs = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "EasyMatchmaking|Diagnostics")
+    float P50Ms = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "EasyMatchmaking|Diagnostics")
+    float P95Ms = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "EasyMatchmaking|Diagnostics")
+    float P99Ms = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "EasyMatchmaking|Diagnostics")
+    float MaxMs = 0.0f;
+};
+
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnEOSOperationTimedOut, const FString& /*Operation*/, uint64 /*OperationId*/, double /*Seconds*/);
+
+// Buckets grow by 25% from 1 ms, so percentiles are off by at most one bucket and memory stays fixed however many calls we see
+class EASYMATCHMAKING_API FLatencyHistogram
+{
+public:
+    static constexpr int32 NumBuckets = 64;
+
+    void Add(double Ms);
+    void Reset();
+
+    // Upper bound of the bucket the percentile falls into, never more than the slowest sample
+    double GetPercentile(double Percentile) const;
+
+    int32 Num() const { return Count; }
+    double GetAverage() const { return Count > 0 ? Sum / Count : 0.0; }
+    double GetMax() const { return Max; }
+
+    static int32 GetBucket(double Ms);
+    static double GetBucketUpperBound(int32 Bucket);
+
+private:
+    int32 Buckets[NumBuckets] = {};
+    int32 Count = 0;
+    double Sum = 0.0;
+    double Max = 0.0;
+};
+
+// Every EOS call in flight gets an id, a start time and a deadline. Answered calls go into a latency histogram per operation,
+// calls that miss their deadline fire OnTimedOut (and the callback given to Begin) once.
+class EASYMATCHMAKING_API FEOSOperationTracker
+{
+public:
+    static FEOSOperationTracker& Get();
+
+    // Timeout <= 0 means no deadline. With bStaysAfterDeadline the call is only counted as timed out at the deadline
+    // and stays in flight, its late Complete still goes into the histogram.
+    uint64 Begin(const TCHAR* Operation, float Timeout, TFunction<void()>&& OnDeadline, bool bStaysAfterDeadline = false);
+    // False if the id is not in flight anymore (timed out or already completed)
+    bool Complete(uint64 OperationId, bool bSucceeded);
+    // Forgets a call that was never sent
+    void Cancel(uint64 OperationId);
+
+    TArray<FEOSOperationStats> GetStats() const;
+    bool FindStats(const FString& Operation, FEOSOperationStats& OutStats) const;
+    int32 GetNumInFlight() const { return InFlight.Num(); }
+
+    // CSV with one row per operation, empty path = Saved/EasyMatchmaking/OperationStats.csv
+    bool DumpToFile(const FString& FilePath = FString()) const;
+    void LogStats() const;
+    void Reset();
+
+    FOnEOSOperationTimedOut OnTimedOut;
+
+private:
+    struct FInFlightOperation
+    {
+        FString Operation;
+        double StartTime = 0.0;
+        // 0 = none
+        double Deadline = 0.0;
+        TFunction<void()> OnDeadline;
+        bool bStaysAfterDeadline = false;
+    };
+
+    struct FOperationRecord
+    {
+        FLatencyHistogram Latency;
+        int32 Failures = 0;
+        int32 TimedOut = 0;
+    };
+
+    FEOSOperationStats MakeStats(const FString& Operation, const FOperationRecord& Record) const;
+    bool CheckDeadlines(float DeltaTime);
+
+    TMap<uint64, FInFlightOperation> InFlight;
+    TMap<FString, FOperationRecord> Records;
+    uint64 NextOperationId = 1;
+    FTSTicker::FDelegateHandle TickerHandle;
+};
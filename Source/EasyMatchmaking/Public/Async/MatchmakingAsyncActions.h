@@ -0,0 +1,315 @@
+#pragma once
+
+#include <eos_common.h>
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Containers/Ticker.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "EOSLobbyManager.h"
+#include "Session/EOSSessionManager.h"
+#include "MatchmakingAsyncActions.generated.h"
+
+class UEOSManager;
+
+// How an async lobby or session step ended
+struct FMatchmakingResult
+{
+    EOS_EResult Result = EOS_EResult::EOS_UnexpectedError;
+    // Lobby or session the step made or worked on, can be empty on failure
+    FString Id;
+
+    bool IsSuccess() const { return Result == EOS_EResult::EOS_Success; }
+    FString GetError() const { return IsSuccess() ? FString() : FString(UTF8_TO_TCHAR(EOS_EResult_ToString(Result))); }
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FMatchmakingAsyncPin, const FString&, Id, const FString&, Error);
+
+// Latent node for one lobby or session step, exactly one of OnSuccess/OnFailure fires.
+// From C++ use ActivateAsFuture (or the helpers in MatchmakingFutures.h) instead of the pins.
+UCLASS(Abstract)
+class EASYMATCHMAKING_API UMatchmakingAsyncAction : public UBlueprintAsyncActionBase
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY(BlueprintAssignable)
+    FMatchmakingAsyncPin OnSuccess;
+
+    UPROPERTY(BlueprintAssignable)
+    FMatchmakingAsyncPin OnFailure;
+
+    virtual void Activate() override;
+
+    // Continuations run on the game thread when the step ends, possibly before this returns
+    TFuture<FMatchmakingResult> ActivateAsFuture();
+
+protected:
+    // Finds the EOS manager and keeps the action alive until it finishes
+    void Setup(UObject* WorldContextObject);
+
+    // Starts the step, every path has to end in Finish
+    virtual void Start() PURE_VIRTUAL(UMatchmakingAsyncAction::Start, );
+    // Unbinds whatever Start bound
+    virtual void Cleanup() {}
+
+    void Finish(EOS_EResult Result, const FString& Id = FString());
+    bool IsFinished() const { return bFinished; }
+
+    UEOSLobbyManager* GetLobbyManager() const;
+    UEOSSessionManager* GetSessionManager() const;
+
+private:
+    TWeakObjectPtr<UEOSManager> EOSManager;
+    TSharedPtr<TPromise<FMatchmakingResult>> Promise;
+    bool bFinished = false;
+};
+
+// Ends with the result of its own call: the request id Call returned, or the lobby id for joins
+UCLASS(Abstract)
+class EASYMATCHMAKING_API ULobbyOperationAsyncAction : public UMatchmakingAsyncAction
+{
+    GENERATED_BODY()
+
+protected:
+    virtual void Start() override;
+    virtual void Cleanup() override;
+
+    virtual ELobbyOperation GetOperation() const PURE_VIRTUAL(ULobbyOperationAsyncAction::GetOperation, return ELobbyOperation::Create;);
+    // Returns the manager's request id, 0 if the result is matched by IsOwnResult alone
+    virtual int32 Call(UEOSLobbyManager* LobbyManager) PURE_VIRTUAL(ULobbyOperationAsyncAction::Call, return 0;);
+    virtual bool IsOwnResult(int32 InRequestId, const FString& LobbyId) const { return InRequestId != 0 && InRequestId == RequestId; }
+
+private:
+    void HandleOperationComplete(ELobbyOperation Operation, EOS_EResult Result, const FString& LobbyId, int32 InRequestId);
+
+    FDelegateHandle OperationHandle;
+    int32 RequestId = 0;
+    // Results that came in before Call returned our request id, by request id
+    TMap<int32, FMatchmakingResult> ResultsDuringCall;
+    bool bCalling = false;
+};
+
+UCLASS()
+class EASYMATCHMAKING_API UAsyncCreateLobby : public ULobbyOperationAsyncAction
+{
+    GENERATED_BODY()
+
+public:
+    UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking|Async", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+    static UAsyncCreateLobby* CreateLobbyAsync(UObject* WorldContextObject, const FLobbySettings& Settings);
+
+protected:
+    virtual ELobbyOperation GetOperation() const override { return ELobbyOperation::Create; }
+    virtual int32 Call(UEOSLobbyManager* LobbyManager) override { return LobbyManager->CreateLobby(Settings); }
+
+private:
+    FLobbySettings Settings;
+};
+
+UCLASS()
+class EASYMATCHMAKING_API UAsyncJoinLobby : public ULobbyOperationAsyncAction
+{
+    GENERATED_BODY()
+
+public:
+    UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking|Async", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+    static UAsyncJoinLobby* JoinLobbyAsync(UObject* WorldContextObject, const FString& LobbyId);
+
+protected:
+    virtual ELobbyOperation GetOperation() const override { return ELobbyOperation::Join; }
+    virtual int32 Call(UEOSLobbyManager* LobbyManager) override { LobbyManager->JoinLobby(LobbyId); return 0; }
+    virtual bool IsOwnResult(int32 InRequestId, const FString& InLobbyId) const override { return InLobbyId == LobbyId; }
+
+private:
+    FString LobbyId;
+};
+
+UCLASS()
+class EASYMATCHMAKING_API UAsyncLeaveLobby : public ULobbyOperationAsyncAction
+{
+    GENERATED_BODY()
+
+public:
+    UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking|Async", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+    static UAsyncLeaveLobby* LeaveLobbyAsync(UObject* WorldContextObject);
+
+protected:
+    virtual ELobbyOperation GetOperation() const override { return ELobbyOperation::Leave; }
+    virtual int32 Call(UEOSLobbyManager* LobbyManager) override { return LobbyManager->LeaveLobby(); }
+};
+
+UCLASS()
+class EASYMATCHMAKING_API UAsyncDestroyLobby : public ULobbyOperationAsyncAction
+{
+    GENERATED_BODY()
+
+public:
+    UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking|Async", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+    static UAsyncDestroyLobby* DestroyLobbyAsync(UObject* WorldContextObject);
+
+protected:
+    virtual ELobbyOperation GetOperation() const override { return ELobbyOperation::Destroy; }
+    virtual int32 Call(UEOSLobbyManager* LobbyManager) override { return LobbyManager->DestroyLobby(); }
+};
+
+// Succeeds once the write is confirmed by the backend
+UCLASS()
+class EASYMATCHMAKING_API UAsyncSetLobbyAttribute : public UMatchmakingAsyncAction
+{
+    GENERATED_BODY()
+
+public:
+    UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking|Async", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+    static UAsyncSetLobbyAttribute* SetLobbyAttributeAsync(UObject* WorldContextObject, ELobbyAttributeScope Scope, const FString& Key, const FLobbyAttributeValue& Value);
+
+protected:
+    virtual void Start() override;
+
+private:
+    ELobbyAttributeScope Scope = ELobbyAttributeScope::Lobby;
+    FString Key;
+    FLobbyAttributeValue Value;
+};
+
+UCLASS()
+class EASYMATCHMAKING_API UAsyncQuickMatch : public UMatchmakingAsyncAction
+{
+    GENERATED_BODY()
+
+public:
+    // Succeeds when a lobby was joined or created, the id is that lobby
+    UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking|Async", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+    static UAsyncQuickMatch* QuickMatchAsync(UObject* WorldContextObject, const FQuickMatchSettings& Settings);
+
+protected:
+    virtual void Start() override;
+    virtual void Cleanup() override;
+
+private:
+    UFUNCTION()
+    void HandleQuickMatchComplete(EQuickMatchResult Result, const FString& LobbyId);
+
+    FQuickMatchSettings Settings;
+};
+
+// Succeeds right away if everyone is ready already, fails if we leave the lobby or the timeout passes
+UCLASS()
+class EASYMATCHMAKING_API UAsyncWaitForAllPlayersReady : public UMatchmakingAsyncAction
+{
+    GENERATED_BODY()
+
+public:
+    UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking|Async", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+    static UAsyncWaitForAllPlayersReady* WaitForAllPlayersReady(UObject* WorldContextObject, float TimeoutSeconds = 0.0f);
+
+protected:
+    virtual void Start() override;
+    virtual void Cleanup() override;
+
+private:
+    UFUNCTION()
+    void HandleAllPlayersReady();
+
+    UFUNCTION()
+    void HandleLobbyLeft();
+
+    float TimeoutSeconds = 0.0f;
+    FTSTicker::FDelegateHandle TimeoutHandle;
+};
+
+// Member side: succeeds with the session the owner published, right away if it is already there
+UCLASS()
+class EASYMATCHMAKING_API UAsyncWaitForSessionAddress : public UMatchmakingAsyncAction
+{
+    GENERATED_BODY()
+
+public:
+    UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking|Async", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+    static UAsyncWaitForSessionAddress* WaitForSessionAddress(UObject* WorldContextObject);
+
+protected:
+    virtual void Start() override;
+    virtual void Cleanup() override;
+
+private:
+    UFUNCTION()
+    void HandleSessionAddressUpdated(const FString& SessionAddress);
+
+    UFUNCTION()
+    void HandleLobbyLeft();
+};
+
+// Same as ULobbyOperationAsyncAction, for session calls
+UCLASS(Abstract)
+class EASYMATCHMAKING_API USessionOperationAsyncAction : public UMatchmakingAsyncAction
+{
+    GENERATED_BODY()
+
+protected:
+    virtual void Start() override;
+    virtual void Cleanup() override;
+
+    virtual ESessionOperation GetOperation() const PURE_VIRTUAL(USessionOperationAsyncAction::GetOperation, return ESessionOperation::Create;);
+    virtual int32 Call(UEOSSessionManager* SessionManager) PURE_VIRTUAL(USessionOperationAsyncAction::Call, return 0;);
+    virtual bool IsOwnResult(int32 InRequestId, const FString& SessionId) const { return InRequestId != 0 && InRequestId == RequestId; }
+
+private:
+    void HandleOperationComplete(ESessionOperation Operation, EOS_EResult Result, const FString& SessionId, int32 InRequestId);
+
+    FDelegateHandle OperationHandle;
+    int32 RequestId = 0;
+    TMap<int32, FMatchmakingResult> ResultsDuringCall;
+    bool bCalling = false;
+};
+
+UCLASS()
+class EASYMATCHMAKING_API UAsyncCreateSession : public USessionOperationAsyncAction
+{
+    GENERATED_BODY()
+
+public:
+    UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking|Async", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+    static UAsyncCreateSession* CreateSessionAsync(UObject* WorldContextObject, const FString& SessionName, int32 MaxPlayers);
+
+protected:
+    virtual ESessionOperation GetOperation() const override { return ESessionOperation::Create; }
+    virtual int32 Call(UEOSSessionManager* SessionManager) override { return SessionManager->CreateSession(SessionName, MaxPlayers); }
+
+private:
+    FString SessionName;
+    int32 MaxPlayers = 0;
+};
+
+// Succeeds once the session is joined, travel to the server starts at the same time
+UCLASS()
+class EASYMATCHMAKING_API UAsyncJoinSession : public USessionOperationAsyncAction
+{
+    GENERATED_BODY()
+
+public:
+    UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking|Async", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+    static UAsyncJoinSession* JoinSessionAsync(UObject* WorldContextObject, const FString& SessionId);
+
+protected:
+    virtual ESessionOperation GetOperation() const override { return ESessionOperation::Join; }
+    virtual int32 Call(UEOSSessionManager* SessionManager) override { SessionManager->JoinSessionById(SessionId); return 0; }
+    virtual bool IsOwnResult(int32 InRequestId, const FString& InSessionId) const override { return InSessionId == SessionId; }
+
+private:
+    FString SessionId;
+};
+
+UCLASS()
+class EASYMATCHMAKING_API UAsyncDestroySession : public USessionOperationAsyncAction
+{
+    GENERATED_BODY()
+
+public:
+    UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking|Async", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+    static UAsyncDestroySession* DestroySessionAsync(UObject* WorldContextObject);
+
+protected:
+    virtual ESessionOperation GetOperation() const override { return ESessionOperation::Destroy; }
+    virtual int32 Call(UEOSSessionManager* SessionManager) override { return SessionManager->DestroySession(); }
+};
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Async/MatchmakingAsyncActions.h"
+
+// C++ side of the async nodes: every step returns a future, continue with Next.
+// Continuations run on the game thread, a step that can't start completes right away.
+// Don't call Get on the game thread, the answer is delivered there.
+//
+//   MatchmakingFutures::CreateLobby(this, Settings).Next([this](FMatchmakingResult Created)
+//   {
+//       MatchmakingFutures::WaitForAllPlayersReady(this, 60.0f).Next(...);
+//   });
+namespace MatchmakingFutures
+{
+    EASYMATCHMAKING_API TFuture<FMatchmakingResult> CreateLobby(UObject* WorldContextObject, const FLobbySettings& Settings);
+    EASYMATCHMAKING_API TFuture<FMatchmakingResult> JoinLobby(UObject* WorldContextObject, const FString& LobbyId);
+    EASYMATCHMAKING_API TFuture<FMatchmakingResult> LeaveLobby(UObject* WorldContextObject);
+    EASYMATCHMAKING_API TFuture<FMatchmakingResult> DestroyLobby(UObject* WorldContextObject);
+    EASYMATCHMAKING_API TFuture<FMatchmakingResult> SetLobbyAttribute(UObject* WorldContextObject, ELobbyAttributeScope Scope, const FString& Key, const FLobbyAttributeValue& Value);
+    EASYMATCHMAKING_API TFuture<FMatchmakingResult> QuickMatch(UObject* WorldContextObject, const FQuickMatchSettings& Settings);
+    EASYMATCHMAKING_API TFuture<FMatchmakingResult> WaitForAllPlayersReady(UObject* WorldContextObject, float TimeoutSeconds = 0.0f);
+    EASYMATCHMAKING_API TFuture<FMatchmakingResult> WaitForSessionAddress(UObject* WorldContextObject);
+
+    EASYMATCHMAKING_API TFuture<FMatchmakingResult> CreateSession(UObject* WorldContextObject, const FString& SessionName, int32 MaxPlayers);
+    EASYMATCHMAKING_API TFuture<FMatchmakingResult> JoinSession(UObject* WorldContextObject, const FString& SessionId);
+    EASYMATCHMAKING_API TFuture<FMatchmakingResult> DestroySession(UObject* WorldContextObject);
+
+    // Completes when all of them did, results in the same order. Useful for a batch of attribute writes.
+    EASYMATCHMAKING_API TFuture<TArray<FMatchmakingResult>> WhenAll(TArray<TFuture<FMatchmakingResult>>&& Futures);
+}
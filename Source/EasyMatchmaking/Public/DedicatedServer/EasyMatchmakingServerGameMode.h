@@ -2,8 +2,11 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/GameModeBase.h"
+#include "Matchmaking/SkillMatchmaker.h"
 #include "EasyMatchmakingServerGameMode.generated.h"
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnSkillMatchFormed, const TArray<APlayerController*>&, Players, double, MinRating, double, MaxRating);
+
 UCLASS()
 class EASYMATCHMAKING_API AEasyMatchmakingServerGameMode : public AGameModeBase
 {
@@ -15,5 +18,39 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Matchmaking")
 	void InitServer();
 
+	void InitGame(const FString& MapName, const FString& Options, FString& ErrorMessage) override;
 	void BeginPlay() override;
+	void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	FString InitNewPlayer(APlayerController* NewPlayerController, const FUniqueNetIdRepl& UniqueId, const FString& Options, const FString& Portal) override;
+	void Logout(AController* Exiting) override;
+
+	// Players that came with a ?Rating= option are queued, every pass groups the closest ratings into matches
+	UPROPERTY(BlueprintAssignable, Category = "Matchmaking")
+	FOnSkillMatchFormed OnSkillMatchFormed;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Matchmaking", meta = (ClampMin = "1"))
+	int32 SkillMatchSize = 4;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Matchmaking", meta = (ClampMin = "0"))
+	float SkillWindow = 100.0f;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Matchmaking", meta = (ClampMin = "0"))
+	float SkillWindowGrowthPerSecond = 20.0f;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Matchmaking", meta = (ClampMin = "0"))
+	float MaxSkillWindow = 1000.0f;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Matchmaking", meta = (ClampMin = "0.1", Units = "s"))
+	float MatchPassInterval = 1.0f;
+
+	// Players still waiting for a match
+	UFUNCTION(BlueprintPure, Category = "Matchmaking")
+	int32 GetQueuedPlayerCount() const { return SkillMatchmaker.Num(); }
+
+private:
+	void RunSkillMatchPass();
+
+	FSkillMatchmaker SkillMatchmaker;
+	TMap<int32, TWeakObjectPtr<APlayerController>> TicketPlayers;
+	FTimerHandle MatchPassTimer;
 };
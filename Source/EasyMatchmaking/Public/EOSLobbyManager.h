@@ -9,30 +9,29 @@
 
 #include "CoreMinimal.h"
 #include "eos_lobby.h"
+#include "Lobby/DisplayNameResolver.h"
+#include "Lobby/LobbyAttributes.h"
+#include "Lobby/LobbyMemberTable.h"
+#include "Lobby/LobbyModificationQueue.h"
+#include "Lobby/LobbyQuickMatch.h"
+#include "Lobby/LobbySearch.h"
+#include "Lobby/LobbySearchCache.h"
+#include "Lobby/LobbySnapshot.h"
 #include "EOSLobbyManager.generated.h"
 
 class UEOSManager;
+struct FLobbySessionServer;
+enum class ESessionOperation : uint8;
 
-USTRUCT(BlueprintType)
-struct FLobbyMemberInfo
+// Maps to EOS_ELobbyPermissionLevel
+UENUM(BlueprintType)
+enum class ELobbyPermission : uint8
 {
-    GENERATED_BODY()
-
-    EOS_ProductUserId UserId;
-
-    UPROPERTY(BlueprintReadOnly, Category = "Lobby Member")
-    FString DisplayName;
-
-    UPROPERTY(BlueprintReadOnly, Category = "Lobby Member")
-    bool bIsLobbyOwner;
-
-    UPROPERTY(BlueprintReadOnly, Category = "Lobby Member")
-    bool bIsReady = false;
-
-    EOS_EpicAccountId EpicAccountId;
-
-    UPROPERTY(BlueprintReadOnly, Category = "Lobby Member")
-    FString EpicAccountIdString;
+    // Shows up in searches
+    PublicAdvertised,
+    // Only joinable through presence (friends) or by id
+    JoinViaPresence,
+    InviteOnly
 };
 
 USTRUCT(BlueprintType)
@@ -46,48 +45,153 @@ struct FLobbySettings
     UPROPERTY(BlueprintReadWrite, Category = "Lobby")
     int32 MaxPlayers = 4;
 
+    // Shorthand for InviteOnly when Permission is left at PublicAdvertised
     UPROPERTY(BlueprintReadWrite, Category = "Lobby")
     bool bIsPrivate = false;
 
+    UPROPERTY(BlueprintReadWrite, Category = "Lobby")
+    ELobbyPermission Permission = ELobbyPermission::PublicAdvertised;
+
     UPROPERTY(BlueprintReadWrite, Category = "Lobby")
     FString BucketId = TEXT("DefaultBucket");
+
+    // Published with the name in the lobby summary, shown by the server browser
+    UPROPERTY(BlueprintReadWrite, Category = "Lobby")
+    FString GameMode;
+
+    UPROPERTY(BlueprintReadWrite, Category = "Lobby")
+    FString MapName;
+
+    // Empty = the region with the lowest measured latency
+    UPROPERTY(BlueprintReadWrite, Category = "Lobby")
+    FString Region;
+
+    UPROPERTY(BlueprintReadWrite, Category = "Lobby")
+    FString BuildId;
+
+    // Lobby attributes written in the same update as the summary, before OnLobbyCreated fires,
+    // so the lobby is never found without them. Reserved keys (summary, region, rating...) are skipped.
+    UPROPERTY(BlueprintReadWrite, Category = "Lobby")
+    TMap<FString, FLobbyAttributeValue> InitialAttributes;
+};
+
+UENUM(BlueprintType)
+enum class EQuickMatchResult : uint8
+{
+    Joined,
+    Created,
+    // Nothing fit and creating was not allowed
+    NoLobbyFound,
+    Failed,
+    Cancelled
 };
 
 USTRUCT(BlueprintType)
-struct FLobbyInfo
+struct FQuickMatchSettings
 {
     GENERATED_BODY()
 
-    UPROPERTY(BlueprintReadOnly, Category = "Lobby")
-    FString LobbyId;
+    UPROPERTY(BlueprintReadWrite, Category = "Quick Match")
+    FString BucketId = TEXT("DefaultBucket");
+
+    // Lobbies with fewer free slots are filtered out by the backend
+    UPROPERTY(BlueprintReadWrite, Category = "Quick Match")
+    int32 MinAvailableSlots = 1;
+
+    UPROPERTY(BlueprintReadWrite, Category = "Quick Match")
+    int32 MaxResults = 20;
+
+    // Checked by the backend (mode, region, build...), lobbies that don't match are never ranked
+    UPROPERTY(BlueprintReadWrite, Category = "Quick Match")
+    TArray<FLobbySearchFilter> Filters;
+
+    // Lobby attributes we would like the lobby to have (e.g. map, mode), each match adds AttributeWeight to the score
+    UPROPERTY(BlueprintReadWrite, Category = "Quick Match")
+    TMap<FString, FString> PreferredAttributes;
+
+    UPROPERTY(BlueprintReadWrite, Category = "Quick Match")
+    float AttributeWeight = 1.0f;
+
+    // How many of the best lobbies to try before giving up on joining
+    UPROPERTY(BlueprintReadWrite, Category = "Quick Match")
+    int32 MaxJoinAttempts = 5;
+
+    UPROPERTY(BlueprintReadWrite, Category = "Quick Match")
+    bool bCreateIfNoneFound = true;
+
+    // Only lobbies whose mean rating is within the skill window of Rating. When none is found the window
+    // widens with the time waited and the search runs again, until MaxSkillWindow is reached.
+    UPROPERTY(BlueprintReadWrite, Category = "Quick Match|Skill")
+    bool bMatchBySkill = false;
 
-    UPROPERTY(BlueprintReadOnly, Category = "Lobby")
-    FString LobbyName;
+    UPROPERTY(BlueprintReadWrite, Category = "Quick Match|Skill")
+    double Rating = 1500.0;
 
-    UPROPERTY(BlueprintReadOnly, Category = "Lobby")
-    FString OwnerUserId;
+    UPROPERTY(BlueprintReadWrite, Category = "Quick Match|Skill")
+    double SkillWindow = 100.0;
 
-    UPROPERTY(BlueprintReadOnly, Category = "Lobby")
-    int32 CurrentPlayers;
+    UPROPERTY(BlueprintReadWrite, Category = "Quick Match|Skill")
+    double SkillWindowGrowthPerSecond = 25.0;
 
-    UPROPERTY(BlueprintReadOnly, Category = "Lobby")
-    int32 MaxPlayers;
+    UPROPERTY(BlueprintReadWrite, Category = "Quick Match|Skill")
+    double MaxSkillWindow = 800.0;
 
-    UPROPERTY(BlueprintReadOnly, Category = "Lobby")
-    FString BucketId;
+    // Seconds between searches while the skill window widens (0 = don't widen)
+    UPROPERTY(BlueprintReadWrite, Category = "Quick Match|Skill")
+    float SkillRetryInterval = 3.0f;
+
+    // Only lobbies in regions we measured within the latency cap (project settings), closer ones rank higher.
+    // The cap widens with the time waited like the skill window. Ignored until region latencies are measured.
+    UPROPERTY(BlueprintReadWrite, Category = "Quick Match|Latency")
+    bool bMatchByLatency = true;
+
+    UPROPERTY(BlueprintReadWrite, Category = "Quick Match|Latency")
+    float LatencyWeight = 1.0f;
+
+    // Seconds between searches while the latency cap widens (0 = don't widen). When both widen the shorter interval is used.
+    UPROPERTY(BlueprintReadWrite, Category = "Quick Match|Latency")
+    float LatencyRetryInterval = 3.0f;
+
+    // Used when no lobby could be joined
+    UPROPERTY(BlueprintReadWrite, Category = "Quick Match")
+    FLobbySettings CreateSettings;
 };
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnLobbyCreated, const FString&, LobbyId);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnLobbiesFound, const TArray<FLobbyInfo>&, FoundLobbies);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FOnLobbiesPage, int32, RequestId, const TArray<FLobbyInfo>&, Lobbies, int32, PageIndex, bool, bHasMore);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnLobbySearchResultsChanged, const TArray<FLobbyInfo>&, ChangedLobbies, const TArray<FString>&, RemovedLobbyIds);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnLobbyJoined, const FString&, LobbyId);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnQuickMatchComplete, EQuickMatchResult, Result, const FString&, LobbyId);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnLobbyLeft);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnAllPlayersReady);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnAllPlayersReadyLost);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnReadyPlayerCountChanged, int32, ReadyCount, int32, MemberCount);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnLobbyMemberEpicGameNicknameGot);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnLobbyMemberDisplayNamesResolved, const TArray<FString>&, MemberIds);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnLobbyMembersChanged);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnLobbyMemberJoined, const FString&, MemberId);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnLobbyMemberLeft, const FString&, MemberId);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnLobbyMemberChanged, const FString&, MemberId);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnLobbyOwnerChanged, const FString&, NewOwnerId, bool, bIsLocalOwner);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnLobbyError, const FString&, ErrorMessage);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnLobbyRejoined, const FString&, LobbyId);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnLobbyRejoinFailed, const FString&, LobbyId, int32, Attempts);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnSessionAddressUpdated, const FString&, SessionAddress);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAllMembersJoinedSession, float, Seconds);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnChatMessageReceived, FString, PlayerName, FString, Message);
 
+enum class ELobbyOperation : uint8
+{
+    Create,
+    Join,
+    Leave,
+    Destroy
+};
+
+// RequestId is what CreateLobby/LeaveLobby/DestroyLobby returned, 0 for joins (match those on the lobby id)
+DECLARE_MULTICAST_DELEGATE_FourParams(FOnLobbyOperationComplete, ELobbyOperation /*Operation*/, EOS_EResult /*Result*/, const FString& /*LobbyId*/, int32 /*RequestId*/);
+
 UCLASS(BlueprintType)
 // Don't forget to call initialize with proper settings
 class EASYMATCHMAKING_API UEOSLobbyManager : public UObject
@@ -103,23 +207,61 @@ public:
     void UnregisterLobbyNotifications();
 
     // --- Lobby operations ---
+    // Create, leave and destroy return the request id OnLobbyOperationComplete reports back
     UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking")
-    void CreateLobby(const FLobbySettings& Settings);
+    int32 CreateLobby(const FLobbySettings& Settings);
 
     UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking")
     void JoinLobby(const FString& LobbyId);
 
     UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking")
-    void LeaveLobby();
+    int32 LeaveLobby();
 
     UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking")
-    void DestroyLobby();
+    int32 DestroyLobby();
 
+    // Returns the request id of the search (the same id if an identical search is still running), INDEX_NONE if it could not start.
+    // A fresh cached answer also gets an id and arrives through OnLobbiesPage on the next tick
     UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking")
-    void SearchLobbies(const FString& BucketId = TEXT("DefaultBucket"));
+    int32 SearchLobbies(const FString& BucketId = TEXT("DefaultBucket"));
+
+    // Same as SearchLobbies, the backend only returns lobbies matching every filter with enough free slots (0 = any)
+    UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking")
+    int32 SearchLobbiesFiltered(const FString& BucketId, const TArray<FLobbySearchFilter>& Filters, int32 MinAvailableSlots = 0);
+
+    // Next page of the last SearchLobbies, false if there is nothing more
+    UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking")
+    bool RequestMoreLobbies();
+
+    UFUNCTION(BlueprintPure, Category = "EasyMatchmaking")
+    bool HasMoreLobbies() const;
+
+    UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking")
+    void CancelLobbySearch(int32 RequestId);
+
+    // Search, pick the best lobby, join it (next best if it filled up meanwhile) or create one. Ends with OnQuickMatchComplete.
+    UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking")
+    bool QuickMatch(const FQuickMatchSettings& Settings);
+
+    UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking")
+    void CancelQuickMatch();
+
+    UFUNCTION(BlueprintPure, Category = "EasyMatchmaking")
+    bool IsQuickMatchRunning() const { return QuickMatchState != EQuickMatchState::Idle; }
+
+    // Replaces the default scorer (fill ratio + preferred attributes), reset with nullptr
+    void SetQuickMatchScorer(FLobbyScorer Scorer) { QuickMatchScorer = MoveTemp(Scorer); }
+
+    // Stops joining the lobby we got disconnected from, OnLobbyRejoinFailed does not fire
+    UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking")
+    void CancelLobbyRejoin();
 
-    // --- Other usefull functions ---
     UFUNCTION(BlueprintPure, Category = "EasyMatchmaking")
+    bool IsRejoiningLobby() const { return !RejoinLobbyId.IsEmpty(); }
+
+    // --- Other usefull functions ---
+    // Asks EOS if we are still in the lobby, if not the lobby state is cleared and OnLobbyLeft fires
+    UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking")
     bool CheckWithEOSIsInLobby();
 
     UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking")
@@ -146,30 +288,82 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "EasyMatchmaking")
     FOnLobbyCreated OnLobbyCreated;
 
+    // C++ only: fires once for every create/join/leave/destroy call with how it ended, also when it could not start
+    FOnLobbyOperationComplete OnLobbyOperationComplete;
+
     UPROPERTY(BlueprintAssignable, Category = "EasyMatchmaking")
     FOnLobbiesFound OnLobbiesFound;
 
+    // Search results arrive page by page, OnLobbiesFound follows each page with everything found so far
+    UPROPERTY(BlueprintAssignable, Category = "EasyMatchmaking")
+    FOnLobbiesPage OnLobbiesPage;
+
+    // Cached results are shown first, when the background refresh finishes only the differences come through here
+    UPROPERTY(BlueprintAssignable, Category = "EasyMatchmaking")
+    FOnLobbySearchResultsChanged OnLobbySearchResultsChanged;
+
     UPROPERTY(BlueprintAssignable, Category = "EasyMatchmaking")
     FOnLobbyJoined OnLobbyJoined;
 
     UPROPERTY(BlueprintAssignable, Category = "EasyMatchmaking")
     FOnLobbyLeft OnLobbyLeft;
 
+    // OnLobbyJoined / OnLobbyCreated still fire before this
+    UPROPERTY(BlueprintAssignable, Category = "EasyMatchmaking")
+    FOnQuickMatchComplete OnQuickMatchComplete;
+
     UPROPERTY(BlueprintAssignable, Category = "EasyMatchmaking")
     FOnLobbyError OnLobbyError;
 
     UPROPERTY(BlueprintAssignable, Category = "EasyMatchmaking")
     FOnSessionAddressUpdated OnSessionAddressUpdated;
 
+    // Owner only: every member joined the session we handed off, Seconds since the address was published
+    UPROPERTY(BlueprintAssignable, Category = "EasyMatchmaking")
+    FOnAllMembersJoinedSession OnAllMembersJoinedSession;
+
+    // Ready events only fire on changes: everyone became ready, someone stopped being ready, the count moved
     UPROPERTY(BlueprintAssignable, Category = "EasyMatchmaking")
     FOnAllPlayersReady OnAllPlayersReady;
 
+    UPROPERTY(BlueprintAssignable, Category = "EasyMatchmaking")
+    FOnAllPlayersReadyLost OnAllPlayersReadyLost;
+
+    UPROPERTY(BlueprintAssignable, Category = "EasyMatchmaking")
+    FOnReadyPlayerCountChanged OnReadyPlayerCountChanged;
+
     UPROPERTY(BlueprintAssignable, Category = "EasyMatchmaking")
     FOnLobbyMembersChanged OnLobbyMembersChanged;
 
+    // Per-member delta events, so UI can patch one row instead of rebuilding the whole list
+    UPROPERTY(BlueprintAssignable, Category = "EasyMatchmaking")
+    FOnLobbyMemberJoined OnLobbyMemberJoined;
+
+    UPROPERTY(BlueprintAssignable, Category = "EasyMatchmaking")
+    FOnLobbyMemberLeft OnLobbyMemberLeft;
+
+    UPROPERTY(BlueprintAssignable, Category = "EasyMatchmaking")
+    FOnLobbyMemberChanged OnLobbyMemberChanged;
+
+    // Host migration, fires after owner-only work (session address, lobby rating, ready check) was taken over
+    UPROPERTY(BlueprintAssignable, Category = "EasyMatchmaking")
+    FOnLobbyOwnerChanged OnLobbyOwnerChanged;
+
+    // Back in the lobby after a disconnect, ready state and member attributes are restored
+    UPROPERTY(BlueprintAssignable, Category = "EasyMatchmaking")
+    FOnLobbyRejoined OnLobbyRejoined;
+
+    // Gave up on the lobby we got disconnected from (gone, or out of attempts)
+    UPROPERTY(BlueprintAssignable, Category = "EasyMatchmaking")
+    FOnLobbyRejoinFailed OnLobbyRejoinFailed;
+
     UPROPERTY(BlueprintAssignable, Category = "EasyMatchmaking")
     FOnLobbyMemberEpicGameNicknameGot OnLobbyMemberEpicGameNicknameGot;
 
+    // Once per resolved batch, with every member whose name arrived in it
+    UPROPERTY(BlueprintAssignable, Category = "EasyMatchmaking")
+    FOnLobbyMemberDisplayNamesResolved OnLobbyMemberDisplayNamesResolved;
+
     // --- Getters ---
     UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking")
     TArray<FString> GetCurrentLobbyPlayers() const { return CurrentPlayers; }
@@ -182,10 +376,18 @@ public:
 
     // Get the session address from the lobby
     UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking")
-    FString GetLobbySessionAddress();
+    FString GetLobbySessionAddress() const;
 
+    // Increases every time the lobby snapshot is rebuilt (0 = no snapshot yet)
     UFUNCTION(BlueprintPure, Category = "EasyMatchmaking")
-    const TMap<FString, FLobbyMemberInfo>& GetLobbyMembers() const { return LobbyMembers; }
+    int32 GetLobbySnapshotVersion() const { return LobbySnapshot.IsValid() ? static_cast<int32>(LobbySnapshot->Version) : 0; }
+
+    // Last lobby state read from EOS, null when not in a lobby
+    TSharedPtr<const FLobbySnapshot> GetLobbySnapshot() const { return LobbySnapshot; }
+
+    // Lobby members in join order
+    UFUNCTION(BlueprintPure, Category = "EasyMatchmaking")
+    const TArray<FLobbyMemberInfo>& GetLobbyMembers() const { return LobbyMembers.GetMembers(); }
 
     UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking")
     FString GetLocalPlayerDisplayName() const { return LocalPlayerDisplayName; }
@@ -197,24 +399,80 @@ public:
     bool IsLobbyOwner() const;
 
     UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking")
-    bool AreAllPlayersReady() const;
+    bool AreAllPlayersReady() const { return bIsInLobby && LobbyMembers.AreAllReady(); }
 
     UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking")
-    int32 GetReadyPlayerCount() const;
+    int32 GetReadyPlayerCount() const { return LobbyMembers.GetReadyCount(); }
 
     // --- Setters ---
     UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking")
     void SetPlayerReady(bool bReady);
 
+    // Published as the "rating" member attribute (now and in every lobby joined later), the owner keeps the lobby's mean rating up to date
+    UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking")
+    void SetPlayerRating(double Rating);
+    const TOptional<double>& GetPlayerRating() const { return LocalPlayerRating; }
+
     // Set the session address in the lobby (owner only)
     UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking")
     void SetLobbySessionAddress(const FString& SessionAddress);
 
+    // Owner only: publishes the resolved server of the session, call right before SetLobbySessionAddress so both go out in one update
+    void SetLobbySessionServer(const FLobbySessionServer& Server);
+
+    // False if the owner did not publish a server for the current session address
+    bool GetLobbySessionServer(FLobbySessionServer& OutServer) const;
+
+    // --- Lobby attributes ---
+    // Declare keys up front, declared keys are read by key into the lobby snapshot (session_address and ready are built in)
+    UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking")
+    void DeclareLobbyAttribute(const FString& Key, ELobbyAttributeType Type);
+
+    UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking")
+    void DeclareMemberAttribute(const FString& Key, ELobbyAttributeType Type);
+
+    // Value from the lobby snapshot, Type is None if the key is not set (or not declared)
+    UFUNCTION(BlueprintPure, Category = "EasyMatchmaking")
+    FLobbyAttributeValue GetLobbyAttribute(const FString& Key) const;
+
+    UFUNCTION(BlueprintPure, Category = "EasyMatchmaking")
+    FLobbyAttributeValue GetMemberAttribute(const FString& MemberId, const FString& Key) const;
+
+    const FLobbyAttributeValue& GetMemberAttributeBySlot(EOS_ProductUserId UserId, int32 Slot) const;
+
+    // Lobby attributes can only be set by the owner
+    UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking")
+    void SetLobbyAttributeBool(const FString& Key, bool bValue) { SetLobbyAttribute(ELobbyAttributeScope::Lobby, Key, FLobbyAttributeValue::MakeBool(bValue)); }
+
+    UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking")
+    void SetLobbyAttributeInt64(const FString& Key, int64 Value) { SetLobbyAttribute(ELobbyAttributeScope::Lobby, Key, FLobbyAttributeValue::MakeInt64(Value)); }
+
+    UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking")
+    void SetLobbyAttributeDouble(const FString& Key, double Value) { SetLobbyAttribute(ELobbyAttributeScope::Lobby, Key, FLobbyAttributeValue::MakeDouble(Value)); }
+
+    UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking")
+    void SetLobbyAttributeString(const FString& Key, const FString& Value) { SetLobbyAttribute(ELobbyAttributeScope::Lobby, Key, FLobbyAttributeValue::MakeString(Value)); }
+
+    // Member attributes are set for the local player
+    UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking")
+    void SetMemberAttributeBool(const FString& Key, bool bValue) { SetLobbyAttribute(ELobbyAttributeScope::Member, Key, FLobbyAttributeValue::MakeBool(bValue)); }
+
+    UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking")
+    void SetMemberAttributeInt64(const FString& Key, int64 Value) { SetLobbyAttribute(ELobbyAttributeScope::Member, Key, FLobbyAttributeValue::MakeInt64(Value)); }
+
+    UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking")
+    void SetMemberAttributeDouble(const FString& Key, double Value) { SetLobbyAttribute(ELobbyAttributeScope::Member, Key, FLobbyAttributeValue::MakeDouble(Value)); }
+
+    UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking")
+    void SetMemberAttributeString(const FString& Key, const FString& Value) { SetLobbyAttribute(ELobbyAttributeScope::Member, Key, FLobbyAttributeValue::MakeString(Value)); }
+
+    // Writes are batched, OnComplete gets the result of the lobby update that carried the value
+    void SetLobbyAttribute(ELobbyAttributeScope Scope, const FString& Key, const FLobbyAttributeValue& Value, FOnLobbyModificationComplete OnComplete = nullptr);
+
 private:
     EOS_HPlatform PlatformHandle = nullptr;
     EOS_HLobby LobbyHandle = nullptr;
     EOS_ProductUserId LocalUserId = nullptr;
-    EOS_HLobbySearch CurrentLobbySearchHandle = nullptr;
     EOS_EpicAccountId AuthenticatedEpicAccountId = nullptr;
     UEOSManager* EOSManager;
 
@@ -231,20 +489,97 @@ private:
     // --- Callbacks ---
     static void OnCreateLobbyComplete(const EOS_Lobby_CreateLobbyCallbackInfo* Data);
     static void OnJoinLobbyComplete(const EOS_Lobby_JoinLobbyCallbackInfo* Data);
+#if defined(EOS_LOBBY_JOINLOBBYBYID_API_LATEST)
+    static void OnJoinLobbyByIdComplete(const EOS_Lobby_JoinLobbyByIdCallbackInfo* Data);
+#endif
     static void OnLeaveLobbyComplete(const EOS_Lobby_LeaveLobbyCallbackInfo* Data);
     static void OnDestroyLobbyComplete(const EOS_Lobby_DestroyLobbyCallbackInfo* Data);
-    static void OnFindLobbiesComplete(const EOS_LobbySearch_FindCallbackInfo* Data);
-    static void OnFindLobbyToJoinComplete(const EOS_LobbySearch_FindCallbackInfo* Data);
-    static void OnQueryUserInfoComplete(const EOS_UserInfo_QueryUserInfoCallbackInfo* Data);
-    static void OnUpdateReadyStatusLobbyComplete(const EOS_Lobby_UpdateLobbyCallbackInfo* Data);
-    static void OnQueryProductUserIdMappingsComplete(const EOS_Connect_QueryProductUserIdMappingsCallbackInfo* Data);
-    static void OnSetSessionAddressComplete(const EOS_Lobby_UpdateLobbyCallbackInfo* Data);
+    static void OnLobbyModificationComplete(const EOS_Lobby_UpdateLobbyCallbackInfo* Data);
     static void EOS_CALL OnIncomingConnectionRequest(const EOS_P2P_OnIncomingConnectionRequestInfo* Data);
     static void EOS_CALL OnRemoteConnectionClosed(const EOS_P2P_OnRemoteConnectionClosedInfo* Data);
 
     // --- Helper Functions ---
-    void GetUserDisplayName(EOS_ProductUserId UserId);
+    // Shares a search with the same query that is still waiting on the backend, otherwise starts a new one.
+    // Every caller is a listener and has to ReleaseListener when done.
+    TSharedPtr<FLobbySearch> AcquireLobbySearch(const FLobbySearchParams& Params);
+    void ReleaseLobbySearch(TSharedPtr<FLobbySearch>& Search);
+    void HandleLobbiesPage(const TArray<FLobbyInfo>& Page, int32 PageIndex, bool bHasMore);
+    void HandleJoinSearchFound(EOS_EResult Result, TWeakPtr<FLobbySearch> WeakSearch);
+    void JoinLobbyWithDetails(EOS_HLobbyDetails LobbyDetails);
+    // Shared by JoinLobby and JoinLobbyById completion
+    void HandleJoinLobbyComplete(EOS_EResult Result, const char* LobbyId);
+    // Keeps a copy of the details handle of every browser row, so joining one skips the lookup
+    void CacheLobbyDetails(int32 PageIndex);
+    void RemoveCachedLobbyDetails(const FString& LobbyId);
+    void ReleaseCachedLobbyDetails();
+    // Copies the lobby details handle once and replaces the snapshot, returns false if we are no longer in the lobby
+    bool RefreshLobbySnapshot();
+    // Same as above, but only re-reads one member (full refresh if there is no snapshot yet)
+    bool RefreshLobbySnapshotMember(EOS_ProductUserId UserId);
+    void RemoveLobbySnapshotMember(EOS_ProductUserId UserId);
+    void ResetLobbySnapshot();
+    // Patch a single entry of LobbyMembers from the snapshot, returns true if the member was added
+    bool UpdateLobbyMember(EOS_ProductUserId UserId);
+    bool RemoveLobbyMember(EOS_ProductUserId UserId);
+    // Fires the ready events if the counters moved since the last call
+    void BroadcastReadyStateChanges();
+    // We are no longer in the lobby (left, kicked, lobby closed), drop everything we cached for it
+    void ClearLobbyState();
+    // Name lookups are batched through DisplayNameResolver, flushed on the next tick
+    void RequestDisplayName(EOS_ProductUserId UserId);
+    void FlushDisplayNameRequests();
+    // Returns true if the user is a lobby member
+    bool ApplyDisplayName(const FResolvedDisplayName& Name);
+    void HandleDisplayNamesResolved(const TArray<FResolvedDisplayName>& Names);
     FString UserIdToString(EOS_ProductUserId UserId) const;
+    // Cached string of a lobby member, only converts for users we don't know yet
+    FString GetMemberIdString(EOS_ProductUserId UserId) const;
+    // Queue a write for the next batched lobby update
+    void QueueLobbyAttribute(ELobbyAttributeScope Scope, int32 Slot, const FLobbyAttributeValue& Value, FOnLobbyModificationComplete&& OnComplete);
+    void ScheduleLobbyModificationFlush();
+    // Sends everything queued as one modification + UpdateLobby
+    void FlushLobbyModifications();
+    // Same, without waiting for the batch window
+    void FlushLobbyModificationsNow();
+    void HandleReadyStatusUpdated(EOS_EResult Result);
+    void HandleSessionAddressUpdated(EOS_EResult Result);
+    // Owner only, packs CurrentSettings into the summary attribute
+    void PublishLobbySummary(FOnLobbyModificationComplete OnComplete = nullptr);
+    // Sends the summary, region, rating and initial attributes as one update, OnLobbyCreated fires when it is answered
+    void PublishInitialLobbyState();
+    void FinishLobbyCreation(EOS_EResult AttributesResult);
+    void HandleQuickMatchSearchFound(EOS_EResult Result, TWeakPtr<FLobbySearch> WeakSearch);
+    // Joins the next candidate, or creates a lobby when none are left
+    void TryNextQuickMatchCandidate();
+    void FinishQuickMatch(EQuickMatchResult Result, const FString& LobbyId);
+    // Search with the current skill window and latency cap, false if the search could not be started
+    bool StartQuickMatchSearch();
+    void RetryQuickMatchSearch();
+    void PublishPlayerRating();
+    // PROMOTED: swaps the owner in the snapshot and member table without reading the lobby again
+    void HandleOwnerPromoted(EOS_ProductUserId NewOwnerId);
+    // We became the owner, pick up what the old one may have left undone
+    void TakeOverOwnerDuties();
+    // Member: joins the session in our slot (see SessionJoinSchedule), retrying while it is busy
+    void ScheduleSessionJoin(const FString& SessionId);
+    void AttemptSessionJoin();
+    void HandleSessionJoinComplete(ESessionOperation Operation, EOS_EResult Result, const FString& SessionId, int32 RequestId);
+    void FinishSessionJoin();
+    // Owner: times the handoff until every member reports the session as joined
+    void StartSessionHandoff(const FString& SessionId);
+    void CheckSessionHandoff();
+    void CancelSessionHandoff();
+    // Lost the lobby without leaving it, join it again with backoff
+    void StartLobbyRejoin(const FString& LobbyId);
+    void ScheduleLobbyRejoin();
+    void AttemptLobbyRejoin();
+    void HandleLobbyRejoinFailed(EOS_EResult Result);
+    void FinishLobbyRejoin(bool bRejoined);
+    // Measured latency to every region, empty if there is nothing to go by
+    const TMap<FString, int32>& GetRegionLatencies() const;
+    void ApplyRegionLatencies(TArray<FLobbyInfo>& Lobbies) const;
+    // Owner only, republishes the mean member rating when it moved
+    void UpdateLobbyRating();
 
     // --- Holding data ---
     bool bIsInLobby = false;
@@ -254,19 +589,86 @@ private:
     FLobbySettings CurrentSettings;
     TArray<FString> CurrentPlayers; // Track current lobby members
     TArray<FLobbyInfo> FoundLobbies;
-    TMap<FString, FLobbyMemberInfo> LobbyMembers;
+    // Searches still waiting for Find, by request id
+    TMap<int32, TSharedRef<FLobbySearch>> PendingLobbySearches;
+    int32 NextLobbySearchRequestId = 1;
+    // Search answered from the cache whose results are not delivered yet (0 = none)
+    int32 CachedResultsRequestId = 0;
+    // Create/leave/destroy calls waiting for EOS, one of each at a time (0 = none)
+    int32 NextLobbyOperationRequestId = 1;
+    int32 CreateRequestId = 0;
+    int32 LeaveRequestId = 0;
+    int32 DestroyRequestId = 0;
+    TSharedPtr<FLobbySearch> BrowserSearch;
+    TSharedPtr<FLobbySearch> JoinSearch;
+    FLobbySearchCache LobbySearchCache;
+    FString BrowserSearchKey;
+    // Browser shows cached rows, the running search only refreshes them
+    bool bRevalidatingBrowserSearch = false;
+    TArray<FLobbyInfo> RevalidatedLobbies;
+    enum class EQuickMatchState : uint8
+    {
+        Idle,
+        Searching,
+        Joining,
+        Creating
+    };
+    EQuickMatchState QuickMatchState = EQuickMatchState::Idle;
+    FQuickMatchSettings QuickMatchSettings;
+    FLobbyScorer QuickMatchScorer;
+    TSharedPtr<FLobbySearch> QuickMatchSearch;
+    // Best first, we own the details handles
+    TArray<FQuickMatchCandidate> QuickMatchCandidates;
+    int32 QuickMatchJoinAttempts = 0;
+    double QuickMatchStartedAt = 0.0;
+    double QuickMatchSkillWindow = 0.0;
+    // 0 = latency is not used
+    int32 QuickMatchLatencyCap = 0;
+    FTimerHandle QuickMatchRetryTimer;
+    TOptional<double> LocalPlayerRating;
+    // Details handles of the lobbies the browser shows, by lobby id (same idea as CachedSessionDetails)
+    TMap<FString, EOS_HLobbyDetails> CachedLobbyDetails;
+    FLobbyMemberTable LobbyMembers;
+    // Last ready state we broadcast, to only fire on transitions
+    int32 BroadcastReadyCount = 0;
+    int32 BroadcastMemberCount = 0;
+    bool bBroadcastAllReady = false;
     FString LastKnownSessionAddress;
 
+    // Rebuilt once per EOS notification, all lobby getters read from here
+    TSharedPtr<const FLobbySnapshot> LobbySnapshot;
+    FLobbyAttributeSchema AttributeSchema;
+    uint32 LobbySnapshotVersion = 0;
+
+    FLobbyModificationQueue LobbyModifications;
+    FTimerHandle LobbyModificationFlushTimer;
+
+    // Our member attributes from the last snapshot we were in, restored after a rejoin
+    FString LastLocalMemberLobbyId;
+    TArray<FLobbyAttributeValue> LastLocalMemberAttributes;
+    FString RejoinLobbyId;
+    TArray<FLobbyAttributeValue> RejoinMemberAttributes;
+    int32 RejoinAttempts = 0;
+    FTimerHandle RejoinTimer;
+
+    // Member side of the session handoff
+    FString SessionJoinId;
+    int32 SessionJoinSlot = 0;
+    int32 SessionJoinAttempts = 0;
+    double SessionJoinStartTime = 0.0;
+    FTimerHandle SessionJoinTimer;
+    FDelegateHandle SessionJoinHandle;
+    // Owner side, the handoff is tracked as an operation so it shows up in the operation stats
+    FString HandoffSessionId;
+    uint64 HandoffOperationId = 0;
+    double HandoffStartTime = 0.0;
+
+    TSharedRef<FDisplayNameResolver> DisplayNameResolver = MakeShared<FDisplayNameResolver>();
+    FTimerHandle DisplayNameFlushTimer;
+
     // For chat
     EOS_NotificationId P2PConnectionRequestNotificationId = EOS_INVALID_NOTIFICATIONID;
     EOS_NotificationId P2PConnectionClosedNotificationId = EOS_INVALID_NOTIFICATIONID;
     FTimerHandle ChatTickTimer;
     EOS_P2P_SocketId ChatSocketId;
-
-    //Structure used to query info from lobby members (for example to display name)
-    struct FUserQueryContext 
-    {
-        UEOSLobbyManager* LobbyManager;
-        EOS_ProductUserId TargetUserId;
-    };
 };
@@ -4,12 +4,17 @@
 #include <eos_connect_types.h>
 
 #include "CoreMinimal.h"
+#include "Async/EOSOperationRunner.h"
+#include "Async/EOSOperationTracker.h"
 #include "EOSLobbyManager.h"
+#include "Matchmaking/RegionLatency.h"
 #include "Session/EOSSessionManager.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "EOSManager.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnUserAuthenticated);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnRegionLatenciesUpdated, const FString&, BestRegion);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnOperationTimedOut, const FString&, Operation, float, Seconds);
 
 UCLASS()
 // It is GameInstanceSubsytem, so it loads when game starts. It
@@ -26,6 +31,10 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "EasyMatchmaking")
     FOnUserAuthenticated OnUserAuthenticated;
 
+    // Fires when the region pings started at login are done
+    UPROPERTY(BlueprintAssignable, Category = "EasyMatchmaking|Regions")
+    FOnRegionLatenciesUpdated OnRegionLatenciesUpdated;
+
     EOS_EpicAccountId GetCurrentEpicAccountId() const { return EpicAccountId; }
 
     UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking")
@@ -40,6 +49,41 @@ public:
     UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking")
     static bool TestEOSInitialization();
 
+    // Pings the configured regions again, e.g. after the network changed
+    UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking|Regions")
+    void MeasureRegionLatencies();
+
+    UFUNCTION(BlueprintPure, Category = "EasyMatchmaking|Regions")
+    TMap<FString, int32> GetRegionLatencies() const { return RegionLatencies; }
+
+    // -1 if the region was not measured or did not answer
+    UFUNCTION(BlueprintPure, Category = "EasyMatchmaking|Regions")
+    int32 GetRegionLatency(const FString& Region) const { return RegionLatency::Find(RegionLatencies, Region); }
+
+    // Empty until the pings are done
+    UFUNCTION(BlueprintPure, Category = "EasyMatchmaking|Regions")
+    FString GetBestRegion() const { return RegionLatency::GetBestRegion(RegionLatencies); }
+
+    const TMap<FString, int32>& GetRegionLatencyMap() const { return RegionLatencies; }
+
+    // Fires when an EOS call got no answer before its deadline (Timeout in the retry settings)
+    UPROPERTY(BlueprintAssignable, Category = "EasyMatchmaking|Diagnostics")
+    FOnOperationTimedOut OnOperationTimedOut;
+
+    // Latency percentiles of every EOS call made so far, per operation
+    UFUNCTION(BlueprintPure, Category = "EasyMatchmaking|Diagnostics")
+    TArray<FEOSOperationStats> GetOperationStats() const { return FEOSOperationTracker::Get().GetStats(); }
+
+    // Writes the stats as CSV, empty path = Saved/EasyMatchmaking/OperationStats.csv
+    UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking|Diagnostics")
+    bool DumpOperationStats(const FString& FilePath) const { return FEOSOperationTracker::Get().DumpToFile(FilePath); }
+
+    UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking|Diagnostics")
+    void ResetOperationStats() { FEOSOperationTracker::Get().Reset(); }
+
+    // Every EOS call of this game instance goes through these
+    const TSharedRef<FEOSCircuitBreaker>& GetCircuitBreaker() const { return CircuitBreaker; }
+
 private:
 
     // Authentication functions
@@ -54,6 +98,8 @@ private:
     // Helper function
     EOS_HPlatform GetPlatformHandle();
 
+    void HandleOperationTimedOut(const FString& Operation, uint64 OperationId, double Seconds);
+
 	// --- Holding data ---
 	// Make these UPROPERTY so they're properly managed by Unreal's garbage collector
     UPROPERTY()
@@ -65,6 +111,13 @@ private:
     FString DevAuthHostStorage;
     FString DevAuthTokenStorage;
 
+    FDelegateHandle OperationTimedOutHandle;
+
+    TSharedPtr<FRegionLatencyProbe> RegionProbe;
+    TSharedRef<FEOSCircuitBreaker> CircuitBreaker = MakeShared<FEOSCircuitBreaker>();
+    // Median round trip in ms per region name
+    TMap<FString, int32> RegionLatencies;
+
     EOS_ProductUserId LocalUserId = nullptr;
     EOS_EpicAccountId EpicAccountId = nullptr;
     FString StoredAuthToken; // Store auth token temporarily
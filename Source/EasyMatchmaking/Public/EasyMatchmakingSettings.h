@@ -19,6 +19,45 @@ struct FEOSDevTestAccounts
     FString DisplayName = TEXT("PIEUser");
 };
 
+USTRUCT(BlueprintType)
+struct FMatchmakingRegion
+{
+    GENERATED_BODY()
+
+    // Advertised by lobbies and sessions, e.g. "eu-central"
+    UPROPERTY(Config, EditAnywhere, Category = "Region")
+    FString Name;
+
+    // Host pinged to measure the latency to this region
+    UPROPERTY(Config, EditAnywhere, Category = "Region")
+    FString PingAddress;
+};
+
+USTRUCT(BlueprintType)
+struct FEOSRetryPolicy
+{
+    GENERATED_BODY()
+
+    // Including the first try, 1 = never retry
+    UPROPERTY(Config, EditAnywhere, Category = "Retry", meta = (ClampMin = "1"))
+    int32 MaxAttempts = 3;
+
+    UPROPERTY(Config, EditAnywhere, Category = "Retry", meta = (ClampMin = "0", Units = "s"))
+    float InitialDelay = 0.5f;
+
+    UPROPERTY(Config, EditAnywhere, Category = "Retry", meta = (ClampMin = "0", Units = "s"))
+    float MaxDelay = 8.0f;
+
+    UPROPERTY(Config, EditAnywhere, Category = "Retry", meta = (ClampMin = "1"))
+    float BackoffMultiplier = 2.0f;
+
+    UPROPERTY(Config, EditAnywhere, Category = "Retry", meta = (ClampMin = "0", ClampMax = "1", ToolTip = "Share of the delay that is randomized so clients don't retry in lockstep"))
+    float Jitter = 0.5f;
+
+    UPROPERTY(Config, EditAnywhere, Category = "Retry", meta = (ClampMin = "0", Units = "s", ToolTip = "A call without an answer by then fails with TimedOut (creates and joins only report it and keep waiting). 0 = wait forever."))
+    float Timeout = 30.0f;
+};
+
 UCLASS(config = Game, defaultconfig, meta = (DisplayName = "Easy Matchmaking"))
 class EASYMATCHMAKING_API UEasyMatchmakingSettings : public UDeveloperSettings
 {
@@ -70,6 +109,93 @@ public:
     UPROPERTY(Config, EditAnywhere, Category = "Overall EOS Settings", meta = (ToolTip = "Overlay dosent work properly while testing in Editor, so it is suggested to disable it (web browser will be used for log-in)"))
     bool DisableOverlay = true;
 
+    UPROPERTY(Config, EditAnywhere, Category = "Lobby", meta = (ClampMin = "0.0", Units = "s", ToolTip = "Lobby and member attribute writes made within this window are sent as one lobby update. 0 = batch everything set during the same frame."))
+    float LobbyUpdateBatchWindow = 0.0f;
+
+    UPROPERTY(Config, EditAnywhere, Category = "Lobby Search", meta = (ClampMin = "1", ClampMax = "200", ToolTip = "Max lobbies one search returns (EOS allows up to 200)"))
+    int32 LobbySearchMaxResults = 50;
+
+    UPROPERTY(Config, EditAnywhere, Category = "Lobby Search", meta = (ClampMin = "1", ToolTip = "Lobbies per OnLobbiesPage event"))
+    int32 LobbySearchPageSize = 20;
+
+    UPROPERTY(Config, EditAnywhere, Category = "Lobby Search", meta = (ClampMin = "0.0", Units = "ms", ToolTip = "Time per frame spent converting search results"))
+    float LobbySearchFrameBudgetMs = 1.0f;
+
+    UPROPERTY(Config, EditAnywhere, Category = "Lobby Search", meta = (ClampMin = "0.0", Units = "s", ToolTip = "Searches repeated within this time are answered from the last results. Older results are still shown right away while a new search runs."))
+    float LobbySearchCacheTTL = 10.0f;
+
+    // Display names are cached in Saved/EasyMatchmaking, entries older than this are still shown but looked up again
+    UPROPERTY(Config, EditAnywhere, Category = "Lobby", meta = (ClampMin = "0.0", Units = "h"))
+    float DisplayNameCacheTTLHours = 24.0f;
+
+    UPROPERTY(Config, EditAnywhere, Category = "Lobby", meta = (ClampMin = "0"))
+    int32 DisplayNameCacheMaxEntries = 256;
+
+    // After a disconnect the lobby is joined again automatically, waiting twice as long after every failed try
+    UPROPERTY(Config, EditAnywhere, Category = "Lobby", meta = (ClampMin = "0", ToolTip = "0 = don't rejoin"))
+    int32 LobbyRejoinMaxAttempts = 5;
+
+    UPROPERTY(Config, EditAnywhere, Category = "Lobby", meta = (ClampMin = "0.0", Units = "s"))
+    float LobbyRejoinInitialDelay = 1.0f;
+
+    UPROPERTY(Config, EditAnywhere, Category = "Lobby", meta = (ClampMin = "0.0", Units = "s"))
+    float LobbyRejoinMaxDelay = 16.0f;
+
+    // When the owner publishes the session, members join it one after another: each gets a fixed slot (the same on every client)
+    UPROPERTY(Config, EditAnywhere, Category = "Lobby", meta = (ClampMin = "0.0", Units = "s", ToolTip = "Time between two members joining the session. 0 = everyone joins at once."))
+    float SessionJoinSlotSpacing = 0.25f;
+
+    UPROPERTY(Config, EditAnywhere, Category = "Lobby", meta = (ClampMin = "1", ToolTip = "Tries per member when the session is busy with another join"))
+    int32 SessionJoinMaxAttempts = 4;
+
+    UPROPERTY(Config, EditAnywhere, Category = "Lobby", meta = (ClampMin = "0.0", Units = "s", ToolTip = "Wait before the first retry, doubles after every busy answer"))
+    float SessionJoinRetryDelay = 0.5f;
+
+    UPROPERTY(Config, EditAnywhere, Category = "Lobby", meta = (ClampMin = "0.0", Units = "s", ToolTip = "Owner side: a handoff where not every member joined by then counts as timed out in the operation stats. 0 = no deadline."))
+    float SessionHandoffTimeout = 60.0f;
+
+    // Pinged after login, lobbies and sessions in regions we can't reach within the latency cap are skipped
+    UPROPERTY(Config, EditAnywhere, Category = "Regions")
+    TArray<FMatchmakingRegion> Regions;
+
+    UPROPERTY(Config, EditAnywhere, Category = "Regions", meta = (ClampMin = "1", ToolTip = "Pings per region, the median is used"))
+    int32 RegionPingCount = 3;
+
+    UPROPERTY(Config, EditAnywhere, Category = "Regions", meta = (ClampMin = "0.1", Units = "s"))
+    float RegionPingTimeout = 1.0f;
+
+    // Region a dedicated server advertises, -Region= on the command line overrides it
+    UPROPERTY(Config, EditAnywhere, Category = "Regions")
+    FString ServerRegion;
+
+    UPROPERTY(Config, EditAnywhere, Category = "Regions", meta = (ClampMin = "0", Units = "ms", ToolTip = "Candidates in regions slower than this are skipped. 0 = no cap."))
+    int32 MaxLatencyMs = 120;
+
+    UPROPERTY(Config, EditAnywhere, Category = "Regions", meta = (ClampMin = "0", Units = "ms", ToolTip = "Quick match raises the cap by this much per second waited"))
+    int32 LatencyWidenMsPerSecond = 10;
+
+    UPROPERTY(Config, EditAnywhere, Category = "Regions", meta = (ClampMin = "0", Units = "ms", ToolTip = "The cap never widens past this"))
+    int32 MaxWidenedLatencyMs = 250;
+
+    // Used by every EOS call that has no override
+    UPROPERTY(Config, EditAnywhere, Category = "Retry")
+    FEOSRetryPolicy DefaultRetryPolicy;
+
+    UPROPERTY(Config, EditAnywhere, Category = "Retry", meta = (ToolTip = "Per operation: CreateLobby, JoinLobby, JoinLobbyById, LeaveLobby, DestroyLobby, UpdateLobby, FindLobbies, CreateSession, JoinSession, DestroySession, FindSessions, AuthLogin, ConnectLogin, CreateUser, QueryUserIdMappings, QueryUserInfo"))
+    TMap<FName, FEOSRetryPolicy> RetryPolicyOverrides;
+
+    UPROPERTY(Config, EditAnywhere, Category = "Retry", meta = (ClampMin = "0", ToolTip = "Transient failures in a row before calls to that service fail fast. 0 = no circuit breaker."))
+    int32 CircuitBreakerFailureThreshold = 5;
+
+    UPROPERTY(Config, EditAnywhere, Category = "Retry", meta = (ClampMin = "0", Units = "s", ToolTip = "How long calls fail fast before one is let through again"))
+    float CircuitBreakerCooldown = 15.0f;
+
+    const FEOSRetryPolicy& GetRetryPolicy(const TCHAR* Operation) const
+    {
+        const FEOSRetryPolicy* Override = RetryPolicyOverrides.Find(FName(Operation, FNAME_Find));
+        return Override ? *Override : DefaultRetryPolicy;
+    }
+
     // Helper to get settings instance
     static const UEasyMatchmakingSettings* Get()
     {
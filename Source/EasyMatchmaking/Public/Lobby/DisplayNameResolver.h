@@ -0,0 +1,86 @@
+#pragma once
+
+#include <eos_types.h>
+#include <eos_connect_types.h>
+#include <eos_userinfo_types.h>
+
+#include "CoreMinimal.h"
+
+class FEOSCircuitBreaker;
+
+struct FResolvedDisplayName
+{
+    EOS_ProductUserId UserId = nullptr;
+    EOS_EpicAccountId EpicAccountId = nullptr;
+    FString EpicAccountIdString;
+    FString DisplayName;
+    // When EOS last confirmed the name (UTC)
+    FDateTime VerifiedAt;
+};
+
+DECLARE_DELEGATE_OneParam(FOnDisplayNamesResolved, const TArray<FResolvedDisplayName>& /*Names*/);
+
+// Resolves ProductUserId -> Epic display name. Users already resolved or in flight are not queried again,
+// everything requested before Flush goes out as one mappings query, user info queries fan out from there
+// and the names of the whole batch come back in one OnResolved call.
+class EASYMATCHMAKING_API FDisplayNameResolver : public TSharedFromThis<FDisplayNameResolver>
+{
+public:
+    void Init(EOS_HPlatform InPlatformHandle, EOS_ProductUserId InLocalUserId, EOS_EpicAccountId InLocalEpicAccountId,
+        const TSharedRef<FEOSCircuitBreaker>& InCircuitBreaker);
+
+    // Reads names saved by an earlier run, they are served right away and the ones older than the TTL are queued for the next Flush
+    void LoadCache();
+
+    // Queues the user for the next Flush, false if there is nothing to query (known and fresh, in flight, failed recently)
+    bool Request(EOS_ProductUserId UserId);
+
+    bool HasQueued() const { return Queued.Num() > 0; }
+
+    void Flush();
+
+    const FResolvedDisplayName* Find(EOS_ProductUserId UserId) const { return Resolved.Find(UserId); }
+
+    FOnDisplayNamesResolved OnResolved;
+
+private:
+    struct FBatch
+    {
+        TWeakPtr<FDisplayNameResolver> Resolver;
+        TArray<EOS_ProductUserId> UserIds;
+        // Keyed by EpicAccountId string, user info callbacks only give us the EpicAccountId
+        TMap<FString, FResolvedDisplayName> PendingUserInfo;
+        TArray<FResolvedDisplayName> Results;
+        int32 PendingQueries = 0;
+    };
+
+    static void EOS_CALL OnQueryMappingsComplete(const EOS_Connect_QueryProductUserIdMappingsCallbackInfo* Data);
+    static void EOS_CALL OnQueryUserInfoComplete(const EOS_UserInfo_QueryUserInfoCallbackInfo* Data);
+
+    // Delivers the results and frees the batch
+    static void FinishBatch(FBatch* Batch);
+
+    // Serializes on the calling thread, writes the file on a worker. Only the newest names are written, all stay in memory
+    void SaveCache();
+    static FString GetCachePath();
+
+    EOS_HPlatform PlatformHandle = nullptr;
+    EOS_ProductUserId LocalUserId = nullptr;
+    EOS_EpicAccountId LocalEpicAccountId = nullptr;
+    TSharedPtr<FEOSCircuitBreaker> CircuitBreaker;
+
+    TArray<EOS_ProductUserId> Queued;
+    TSet<EOS_ProductUserId> InFlight;
+    TMap<EOS_ProductUserId, FResolvedDisplayName> Resolved;
+    // Users without a name (no Epic account, query failed) are not asked again for a while
+    TMap<EOS_ProductUserId, double> FailedAt;
+
+    // Saves can overlap when batches finish close together, a snapshot older than the one on disk is dropped
+    struct FCacheWriter
+    {
+        FCriticalSection Lock;
+        int32 WrittenSequence = 0;
+    };
+    TSharedRef<FCacheWriter, ESPMode::ThreadSafe> CacheWriter = MakeShared<FCacheWriter, ESPMode::ThreadSafe>();
+    int32 SaveSequence = 0;
+};
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <eos_lobby_types.h>
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "LobbyAttributes.generated.h"
+
+UENUM(BlueprintType)
+enum class ELobbyAttributeType : uint8
+{
+    None,
+    Bool,
+    Int64,
+    Double,
+    String
+};
+
+// Lobby attributes can only be written by the owner, member attributes by each member for themselves
+UENUM(BlueprintType)
+enum class ELobbyAttributeScope : uint8
+{
+    Lobby,
+    Member
+};
+
+USTRUCT(BlueprintType)
+struct EASYMATCHMAKING_API FLobbyAttributeValue
+{
+    GENERATED_BODY()
+
+    // None = attribute is not set in the lobby
+    UPROPERTY(BlueprintReadOnly, Category = "Lobby Attribute")
+    ELobbyAttributeType Type = ELobbyAttributeType::None;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Lobby Attribute")
+    bool BoolValue = false;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Lobby Attribute")
+    int64 Int64Value = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Lobby Attribute")
+    double DoubleValue = 0.0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Lobby Attribute")
+    FString StringValue;
+
+    bool IsSet() const { return Type != ELobbyAttributeType::None; }
+
+    static FLobbyAttributeValue MakeBool(bool bValue);
+    static FLobbyAttributeValue MakeInt64(int64 Value);
+    static FLobbyAttributeValue MakeDouble(double Value);
+    static FLobbyAttributeValue MakeString(const FString& Value);
+
+    static FLobbyAttributeValue FromEOS(const EOS_Lobby_AttributeData& Data);
+
+    // Fills EOS attribute data. Key and string value point into the given storage, keep it alive until the EOS call is done.
+    void ToEOS(EOS_Lobby_AttributeData& OutData, const char* Key, TArray<ANSICHAR>& StringStorage) const;
+
+    FString ToString() const;
+
+    bool operator==(const FLobbyAttributeValue& Other) const;
+    bool operator!=(const FLobbyAttributeValue& Other) const { return !(*this == Other); }
+};
+
+// Blueprint side of FLobbyAttributeValue: values for initial lobby attributes, search filters and the async set node
+UCLASS()
+class EASYMATCHMAKING_API ULobbyAttributeLibrary : public UBlueprintFunctionLibrary
+{
+    GENERATED_BODY()
+
+public:
+    UFUNCTION(BlueprintPure, Category = "EasyMatchmaking|Lobby Attribute")
+    static FLobbyAttributeValue MakeLobbyAttributeBool(bool bValue) { return FLobbyAttributeValue::MakeBool(bValue); }
+
+    UFUNCTION(BlueprintPure, Category = "EasyMatchmaking|Lobby Attribute")
+    static FLobbyAttributeValue MakeLobbyAttributeInt(int64 Value) { return FLobbyAttributeValue::MakeInt64(Value); }
+
+    UFUNCTION(BlueprintPure, Category = "EasyMatchmaking|Lobby Attribute")
+    static FLobbyAttributeValue MakeLobbyAttributeDouble(double Value) { return FLobbyAttributeValue::MakeDouble(Value); }
+
+    UFUNCTION(BlueprintPure, Category = "EasyMatchmaking|Lobby Attribute")
+    static FLobbyAttributeValue MakeLobbyAttributeString(const FString& Value) { return FLobbyAttributeValue::MakeString(Value); }
+
+    UFUNCTION(BlueprintPure, Category = "EasyMatchmaking|Lobby Attribute")
+    static bool IsLobbyAttributeSet(const FLobbyAttributeValue& Value) { return Value.IsSet(); }
+
+    UFUNCTION(BlueprintPure, Category = "EasyMatchmaking|Lobby Attribute", meta = (DisplayName = "To String (Lobby Attribute)", CompactNodeTitle = "->", BlueprintAutocast))
+    static FString LobbyAttributeToString(const FLobbyAttributeValue& Value) { return Value.ToString(); }
+};
+
+// Keys used by the plugin itself
+namespace LobbyAttributeKeys
+{
+    inline const TCHAR* SessionAddress = TEXT("session_address");
+    inline const TCHAR* Ready = TEXT("ready");
+    // Packed FLobbySummary
+    inline const TCHAR* Summary = TEXT("summary");
+    inline const char* SummaryUtf8 = "summary";
+    // Member: the player's skill rating. Lobby: mean rating of the members, kept up to date by the owner.
+    inline const TCHAR* Rating = TEXT("rating");
+    inline const char* RatingUtf8 = "rating";
+    // Lobby: region the lobby plays in, kept out of the summary so searches can filter on it
+    inline const TCHAR* Region = TEXT("region");
+    inline const char* RegionUtf8 = "region";
+    // Lobby: packed FLobbySessionServer, the resolved server of session_address
+    inline const TCHAR* SessionServer = TEXT("session_server");
+    // Member: id of the session the member joined after the owner handed it off
+    inline const TCHAR* JoinedSession = TEXT("joined_session");
+}
+
+// Attribute keys declared up front. Every declared key gets a slot, snapshots store values in arrays indexed by slot,
+// and they are read with EOS_LobbyDetails_Copy(Member)AttributeByKey instead of walking every attribute.
+class EASYMATCHMAKING_API FLobbyAttributeSchema
+{
+public:
+    struct FKey
+    {
+        FString Key;
+        TArray<ANSICHAR> Utf8Key; // null terminated, converted once
+        ELobbyAttributeType Type = ELobbyAttributeType::None;
+    };
+
+    // Slots of the built-in keys
+    static constexpr int32 SessionAddressSlot = 0;
+    static constexpr int32 SummarySlot = 1;
+    static constexpr int32 LobbyRatingSlot = 2;
+    static constexpr int32 LobbyRegionSlot = 3;
+    static constexpr int32 SessionServerSlot = 4;
+    static constexpr int32 ReadySlot = 0;
+    static constexpr int32 MemberRatingSlot = 1;
+    static constexpr int32 JoinedSessionSlot = 2;
+
+    FLobbyAttributeSchema();
+
+    // Returns the slot of the key, declaring it if needed
+    int32 Declare(ELobbyAttributeScope Scope, const FString& Key, ELobbyAttributeType Type);
+
+    // INDEX_NONE if the key was not declared
+    int32 FindSlot(ELobbyAttributeScope Scope, const FString& Key) const;
+
+    const TArray<FKey>& GetKeys(ELobbyAttributeScope Scope) const { return Scope == ELobbyAttributeScope::Lobby ? LobbyKeys : MemberKeys; }
+
+    const FKey* GetKey(ELobbyAttributeScope Scope, int32 Slot) const
+    {
+        const TArray<FKey>& Keys = GetKeys(Scope);
+        return Keys.IsValidIndex(Slot) ? &Keys[Slot] : nullptr;
+    }
+
+private:
+    TArray<FKey> LobbyKeys;
+    TArray<FKey> MemberKeys;
+    TMap<FString, int32> LobbySlotByKey;
+    TMap<FString, int32> MemberSlotByKey;
+};
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <eos_types.h>
+
+#include "CoreMinimal.h"
+#include "LobbyMemberTable.generated.h"
+
+USTRUCT(BlueprintType)
+struct FLobbyMemberInfo
+{
+    GENERATED_BODY()
+
+    EOS_ProductUserId UserId = nullptr;
+
+    // ProductUserId as string, converted once when the member is added
+    UPROPERTY(BlueprintReadOnly, Category = "Lobby Member")
+    FString UserIdString;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Lobby Member")
+    FString DisplayName;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Lobby Member")
+    bool bIsLobbyOwner = false;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Lobby Member")
+    bool bIsReady = false;
+
+    EOS_EpicAccountId EpicAccountId = nullptr;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Lobby Member")
+    FString EpicAccountIdString;
+};
+
+// Lobby members keyed directly by EOS_ProductUserId (EOS gives us the same handle for the same user),
+// stored contiguously in join order so Blueprint gets a stable list without any conversion.
+class EASYMATCHMAKING_API FLobbyMemberTable
+{
+public:
+    FLobbyMemberInfo* Find(EOS_ProductUserId UserId);
+    const FLobbyMemberInfo* Find(EOS_ProductUserId UserId) const;
+
+    bool Contains(EOS_ProductUserId UserId) const { return IndexByUserId.Contains(UserId); }
+
+    // New members are appended, so the array stays in join order
+    FLobbyMemberInfo& FindOrAdd(EOS_ProductUserId UserId, const FString& UserIdString, bool* bOutAdded = nullptr);
+
+    // Keeps the order of the remaining members
+    bool Remove(EOS_ProductUserId UserId);
+
+    // Go through here instead of writing bIsReady, so the ready count stays in sync
+    void SetReady(FLobbyMemberInfo& Member, bool bReady);
+
+    int32 GetReadyCount() const { return ReadyCount; }
+    bool AreAllReady() const { return Members.Num() > 0 && ReadyCount == Members.Num(); }
+
+    // Removes every member the predicate returns true for, keeps the order of the rest
+    template <typename PredicateType>
+    int32 RemoveAll(PredicateType Predicate)
+    {
+        const int32 NumRemoved = Members.RemoveAll(Predicate);
+        if (NumRemoved > 0)
+        {
+            RebuildIndex();
+            RecountReady();
+        }
+        return NumRemoved;
+    }
+
+    void Reset();
+
+    int32 Num() const { return Members.Num(); }
+
+    // Contiguous, join-ordered view
+    const TArray<FLobbyMemberInfo>& GetMembers() const { return Members; }
+
+    TArray<FLobbyMemberInfo>::RangedForIteratorType begin() { return Members.begin(); }
+    TArray<FLobbyMemberInfo>::RangedForIteratorType end() { return Members.end(); }
+    TArray<FLobbyMemberInfo>::RangedForConstIteratorType begin() const { return Members.begin(); }
+    TArray<FLobbyMemberInfo>::RangedForConstIteratorType end() const { return Members.end(); }
+
+private:
+    void RebuildIndex(int32 FromIndex = 0);
+    void RecountReady();
+
+    TArray<FLobbyMemberInfo> Members;
+    TMap<EOS_ProductUserId, int32> IndexByUserId;
+    int32 ReadyCount = 0;
+};
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <eos_common.h>
+
+#include "CoreMinimal.h"
+#include "Lobby/LobbyAttributes.h"
+
+using FOnLobbyModificationComplete = TFunction<void(EOS_EResult)>;
+
+// Collects attribute writes so everything set within a frame (or the configured window) goes out as one UpdateLobby.
+// Only one batch is in flight at a time, writes made meanwhile wait for the next one.
+class EASYMATCHMAKING_API FLobbyModificationQueue
+{
+public:
+    struct FWrite
+    {
+        ELobbyAttributeScope Scope = ELobbyAttributeScope::Lobby;
+        int32 Slot = INDEX_NONE;
+        FLobbyAttributeValue Value;
+    };
+
+    // A later write to the same key replaces the pending value, both callers get the result of the batch
+    void Enqueue(ELobbyAttributeScope Scope, int32 Slot, const FLobbyAttributeValue& Value, FOnLobbyModificationComplete&& OnComplete);
+
+    bool HasPending() const { return PendingWrites.Num() > 0; }
+    bool IsInFlight() const { return bInFlight; }
+
+    // Moves the pending writes into the in-flight batch, false if there is nothing to send or a batch is still in flight
+    bool BeginFlush(TArray<FWrite>& OutWrites);
+
+    // Fires the callbacks of the in-flight batch
+    void CompleteFlush(EOS_EResult Result);
+
+    // Drops pending writes (the in-flight batch still completes through CompleteFlush)
+    void CancelPending(EOS_EResult Result);
+
+private:
+    static void Fire(TArray<FOnLobbyModificationComplete>& Callbacks, EOS_EResult Result);
+
+    // Only a handful of keys per batch, a linear search is cheaper than hashing
+    TArray<FWrite> PendingWrites;
+    TArray<FOnLobbyModificationComplete> PendingCallbacks;
+    TArray<FOnLobbyModificationComplete> InFlightCallbacks;
+    bool bInFlight = false;
+};
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <eos_lobby_types.h>
+
+#include "CoreMinimal.h"
+#include "Lobby/LobbySearch.h"
+
+// Higher is better, below zero = don't join this lobby
+using FLobbyScorer = TFunction<float(const FLobbyInfo& /*Lobby*/, EOS_HLobbyDetails /*LobbyDetails*/)>;
+
+struct FQuickMatchCandidate
+{
+    FLobbyInfo Lobby;
+    // Owned by the candidate list, see ReleaseCandidates
+    EOS_HLobbyDetails LobbyDetails = nullptr;
+    float Score = 0.0f;
+};
+
+namespace LobbyQuickMatch
+{
+    // 0 for an empty lobby, 1 for a full one. Fuller lobbies start sooner.
+    float ScoreFillRatio(const FLobbyInfo& Lobby);
+
+    // Number of lobby attributes that have the wanted value (compared as strings)
+    int32 CountMatchingAttributes(EOS_HLobbyDetails LobbyDetails, const TMap<FString, FString>& WantedAttributes);
+
+    // Lobby rating attribute, false if the lobby does not publish one
+    bool GetLobbyRating(EOS_HLobbyDetails LobbyDetails, double& OutRating);
+
+    // 1 for the same rating, 0 at the edge of the window, below zero outside of it or without a rating
+    float ScoreSkill(EOS_HLobbyDetails LobbyDetails, double Rating, double Window);
+
+    // 1 right next to us, 0 at the cap, below zero over it. 0 when the latency is unknown, such lobbies are not rejected.
+    float ScoreLatency(int32 LatencyMs, int32 CapMs);
+
+    // Fill ratio plus AttributeWeight for every matching wanted attribute
+    FLobbyScorer MakeDefaultScorer(const TMap<FString, FString>& WantedAttributes, float AttributeWeight);
+
+    // Copies every result out of a found search and scores it, best first.
+    // Full lobbies and rejected ones are left out. The caller owns the details handles.
+    TArray<FQuickMatchCandidate> RankCandidates(const FLobbySearch& Search, const FLobbyScorer& Scorer);
+
+    void ReleaseCandidates(TArray<FQuickMatchCandidate>& Candidates);
+}
@@ -0,0 +1,195 @@
+#pragma once
+
+#include <eos_lobby_types.h>
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Lobby/LobbyAttributes.h"
+#include "LobbySearch.generated.h"
+
+class FEOSCircuitBreaker;
+
+USTRUCT(BlueprintType)
+struct FLobbyInfo
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Lobby")
+    FString LobbyId;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Lobby")
+    FString LobbyName;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Lobby")
+    FString OwnerUserId;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Lobby")
+    int32 CurrentPlayers = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Lobby")
+    int32 MaxPlayers = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Lobby")
+    FString BucketId;
+
+    // From the lobby summary attribute, empty if the owner did not publish one
+    UPROPERTY(BlueprintReadOnly, Category = "Lobby")
+    FString GameMode;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Lobby")
+    FString MapName;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Lobby")
+    FString Region;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Lobby")
+    FString BuildId;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Lobby")
+    bool bIsPrivate = false;
+
+    // Our measured latency to the lobby's region, -1 if unknown
+    UPROPERTY(BlueprintReadOnly, Category = "Lobby")
+    int32 LatencyMs = -1;
+};
+
+UENUM(BlueprintType)
+enum class ELobbySearchComparison : uint8
+{
+    Equal,
+    NotEqual,
+    GreaterThan,
+    GreaterThanOrEqual,
+    LessThan,
+    LessThanOrEqual,
+    // Value <= attribute <= MaxValue, sent as two parameters
+    Range,
+    // String attribute contains the value
+    Contains,
+    // String attribute is one of the values in a semicolon separated list
+    AnyOf
+};
+
+// One search parameter, checked by the backend so lobbies that don't match never get downloaded
+USTRUCT(BlueprintType)
+struct EASYMATCHMAKING_API FLobbySearchFilter
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadWrite, Category = "Lobby Search")
+    FString Key;
+
+    UPROPERTY(BlueprintReadWrite, Category = "Lobby Search")
+    FLobbyAttributeValue Value;
+
+    UPROPERTY(BlueprintReadWrite, Category = "Lobby Search")
+    ELobbySearchComparison Comparison = ELobbySearchComparison::Equal;
+
+    // Upper bound, only used by Range
+    UPROPERTY(BlueprintReadWrite, Category = "Lobby Search")
+    FLobbyAttributeValue MaxValue;
+
+    static FLobbySearchFilter Make(const FString& Key, const FLobbyAttributeValue& Value, ELobbySearchComparison Comparison = ELobbySearchComparison::Equal);
+    static FLobbySearchFilter MakeRange(const FString& Key, const FLobbyAttributeValue& Min, const FLobbyAttributeValue& Max);
+
+    FString ToString() const;
+};
+
+struct EASYMATCHMAKING_API FLobbySearchParams
+{
+    FString BucketId;
+    // Set to look up one lobby
+    FString LobbyId;
+    int32 MaxResults = 50;
+    // Only lobbies with at least this many free slots, 0 = no filter
+    int32 MinAvailableSlots = 0;
+    // Attribute filters, all of them have to match
+    TArray<FLobbySearchFilter> Filters;
+
+    // Same key = same backend query, used to share searches in flight and to cache results
+    FString MakeKey() const;
+};
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnLobbySearchFound, EOS_EResult /*Result*/);
+DECLARE_DELEGATE_ThreeParams(FOnLobbySearchPage, const TArray<FLobbyInfo>& /*Page*/, int32 /*PageIndex*/, bool /*bHasMore*/);
+
+// One lobby search. EOS returns every result of a search at once (there is no offset paging), so the handle is kept
+// and results are converted into FLobbyInfo a few per frame and handed out page by page. One page ahead of what was
+// asked for is converted in the background, so asking for the next page usually answers right away.
+// Every search owns its handle and has a request id. Several listeners can share one search (same query while it is in flight),
+// the search is cancelled once the last one lets go of it.
+class EASYMATCHMAKING_API FLobbySearch : public TSharedFromThis<FLobbySearch>
+{
+public:
+    FLobbySearch(int32 InRequestId, const FLobbySearchParams& InParams);
+    ~FLobbySearch();
+
+    // Creates the search handle and sends Find. MaxResults is clamped to what EOS allows.
+    bool Start(EOS_HLobby LobbyHandle, EOS_ProductUserId LocalUserId, const TSharedRef<FEOSCircuitBreaker>& CircuitBreaker, int32 InPageSize, float InFrameBudgetMs);
+
+    // Stops converting and releases the handle. Listeners still waiting for Find get EOS_Canceled, nothing fires after that.
+    void Cancel();
+
+    void AddListener() { NumListeners++; }
+    // Cancels the search when the last listener is gone, returns true if it did
+    bool ReleaseListener();
+
+    int32 GetRequestId() const { return RequestId; }
+    const FLobbySearchParams& GetParams() const { return Params; }
+    const FString& GetKey() const { return Key; }
+    bool IsCancelled() const { return bCancelled; }
+
+    uint32 GetResultCount() const { return ResultCount; }
+    // Copy of the details handle of one result, the caller releases it
+    EOS_HLobbyDetails CopyResultDetails(uint32 Index) const;
+
+    // Asks for one more page, false if there is nothing left
+    bool RequestNextPage();
+
+    // Converts and delivers every result, e.g. to refresh a cached list
+    void RequestAllPages();
+
+    int32 GetPageSize() const { return PageSize; }
+    bool IsFound() const { return bFound; }
+    bool HasMorePages() const { return !bFound || DeliveredPages * PageSize < static_cast<int32>(ResultCount); }
+
+    // Everything converted so far, in search order
+    const TArray<FLobbyInfo>& GetResults() const { return Results; }
+
+    static FLobbyInfo MakeLobbyInfo(EOS_HLobbyDetails LobbyDetails);
+
+    FOnLobbySearchFound OnFound;
+    FOnLobbySearchPage OnPage;
+
+private:
+    static void EOS_CALL OnFindComplete(const EOS_LobbySearch_FindCallbackInfo* Data);
+
+    bool SetParameter(const char* AttrKey, const FLobbyAttributeValue& Value, EOS_EComparisonOp ComparisonOp);
+    // Compiles bucket, free slots and attribute filters into search parameters
+    bool ApplyParams();
+
+    bool Tick(float DeltaTime);
+    void StartConverting();
+    void StopConverting();
+    bool ConvertNext();
+    void DeliverPages();
+
+    int32 RequestId = 0;
+    FLobbySearchParams Params;
+    FString Key;
+    int32 NumListeners = 0;
+    bool bCancelled = false;
+
+    EOS_HLobbySearch SearchHandle = nullptr;
+    FTSTicker::FDelegateHandle TickerHandle;
+
+    int32 PageSize = 20;
+    double FrameBudgetSeconds = 0.001;
+
+    bool bFound = false;
+    bool bAllPages = false;
+    uint32 ResultCount = 0;
+    int32 RequestedPages = 0;
+    int32 DeliveredPages = 0;
+    TArray<FLobbyInfo> Results;
+};
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Lobby/LobbySearch.h"
+
+// Last results per search (bucket + filters), so the browser can show something right away
+// while a fresh search runs in the background.
+class EASYMATCHMAKING_API FLobbySearchCache
+{
+public:
+    struct FEntry
+    {
+        TArray<FLobbyInfo> Lobbies;
+        double FetchedAt = 0.0;
+        // False while only some pages of the search were converted
+        bool bComplete = false;
+    };
+
+    // Keyed by FLobbySearchParams::MakeKey
+    const FEntry* Find(const FString& Key) const { return Entries.Find(Key); }
+    bool IsFresh(const FEntry& Entry, double TTLSeconds) const;
+
+    void Store(const FString& Key, const TArray<FLobbyInfo>& Lobbies, bool bComplete);
+
+    // Rows that are new or different in NewLobbies, and ids that are gone
+    static void Diff(const TArray<FLobbyInfo>& OldLobbies, const TArray<FLobbyInfo>& NewLobbies, TArray<FLobbyInfo>& OutChanged, TArray<FString>& OutRemovedIds);
+
+private:
+    TMap<FString, FEntry> Entries;
+};
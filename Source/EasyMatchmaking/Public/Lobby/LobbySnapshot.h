@@ -0,0 +1,65 @@
+#pragma once
+
+#include <eos_lobby_types.h>
+
+#include "CoreMinimal.h"
+#include "Lobby/LobbyAttributes.h"
+
+// One member as seen in the last lobby snapshot
+struct FLobbySnapshotMember
+{
+    EOS_ProductUserId UserId = nullptr;
+    FString UserIdString;
+    bool bIsReady = false;
+
+    // Values of the declared member attributes, indexed by schema slot
+    TArray<FLobbyAttributeValue> Attributes;
+};
+
+// Immutable copy of everything we need from an EOS lobby details handle (owner, members, attributes, slots).
+// It is rebuilt once per EOS notification, so getters like IsLobbyOwner() never have to copy a handle again.
+struct EASYMATCHMAKING_API FLobbySnapshot
+{
+    // Increases every time the lobby manager rebuilds the snapshot
+    uint32 Version = 0;
+
+    FString LobbyId;
+    FString BucketId;
+    EOS_ProductUserId OwnerUserId = nullptr;
+    FString OwnerUserIdString;
+    int32 MaxMembers = 0;
+    int32 AvailableSlots = 0;
+
+    TArray<FLobbySnapshotMember> Members;
+
+    // Values of the declared lobby attributes, indexed by schema slot
+    TArray<FLobbyAttributeValue> Attributes;
+
+    int32 GetCurrentMemberCount() const { return MaxMembers - AvailableSlots; }
+
+    // Unset value if the slot is unknown (key declared after this snapshot was built)
+    const FLobbyAttributeValue& GetAttribute(int32 Slot) const;
+
+    const FLobbySnapshotMember* FindMember(EOS_ProductUserId UserId) const;
+
+    // Reads a details handle once (caller keeps ownership of the handle). Returns null if the info can't be copied.
+    // Member id strings are taken from the previous snapshot when we have them, so each member is converted once.
+    static TSharedPtr<const FLobbySnapshot> Build(EOS_HLobbyDetails LobbyDetails, uint32 InVersion, const FLobbyAttributeSchema& Schema, const FLobbySnapshot* Previous = nullptr);
+
+    // Copy of this snapshot where only one member (and the slot info) is read again from the details handle.
+    // The member is appended if it is new.
+    TSharedPtr<const FLobbySnapshot> WithMemberUpdated(EOS_HLobbyDetails LobbyDetails, EOS_ProductUserId UserId, uint32 InVersion, const FLobbyAttributeSchema& Schema) const;
+
+    // Copy of this snapshot without the given member, no EOS calls needed
+    TSharedPtr<const FLobbySnapshot> WithMemberRemoved(EOS_ProductUserId UserId, uint32 InVersion) const;
+
+    // Copy of this snapshot with another owner, no EOS calls needed
+    TSharedPtr<const FLobbySnapshot> WithOwner(EOS_ProductUserId NewOwnerId, uint32 InVersion) const;
+
+    static const FLobbyAttributeValue& GetAttributeFrom(const TArray<FLobbyAttributeValue>& Values, int32 Slot);
+
+private:
+    bool ReadInfo(EOS_HLobbyDetails LobbyDetails);
+    void ReadAttributes(EOS_HLobbyDetails LobbyDetails, const FLobbyAttributeSchema& Schema);
+    static FLobbySnapshotMember ReadMember(EOS_HLobbyDetails LobbyDetails, EOS_ProductUserId UserId, const FLobbyAttributeSchema& Schema, const FLobbySnapshotMember* Previous);
+};
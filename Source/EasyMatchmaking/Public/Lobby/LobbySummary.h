@@ -0,0 +1,45 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FLobbyInfo;
+
+// Everything a server browser row needs, packed into the one "summary" lobby attribute, so a single search fills the row.
+// Encoded as "<version>|name|mode|map|region|build|flags", '|' and '\' inside fields are escaped with '\'.
+// Decoding skips fields it does not know, so older clients can read summaries from newer ones.
+struct EASYMATCHMAKING_API FLobbySummary
+{
+    static constexpr int32 CurrentVersion = 1;
+    // Longer fields are cut, the whole value has to stay under the EOS attribute length limit
+    static constexpr int32 MaxFieldLength = 64;
+
+    FString LobbyName;
+    FString GameMode;
+    FString MapName;
+    FString Region;
+    FString BuildId;
+    bool bIsPrivate = false;
+
+    FString Encode() const;
+    // False if the value is not a summary we can read
+    static bool Decode(const FString& Encoded, FLobbySummary& OutSummary);
+
+    void ApplyTo(FLobbyInfo& LobbyInfo) const;
+};
+
+// The server behind the session the owner handed off, packed into the "session_server" lobby attribute next to session_address.
+// Members travel to ServerAddress straight away instead of searching for the session first.
+// Encoded as "<version>|session id|host:port|bucket|region", same escaping and versioning as the summary.
+struct EASYMATCHMAKING_API FLobbySessionServer
+{
+    static constexpr int32 CurrentVersion = 1;
+
+    // Session the address belongs to, the address is only used while it matches session_address
+    FString SessionId;
+    FString ServerAddress;
+    FString BucketId;
+    FString Region;
+
+    FString Encode() const;
+    static bool Decode(const FString& Encoded, FLobbySessionServer& OutServer);
+};
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <eos_common.h>
+
+#include "CoreMinimal.h"
+#include "Lobby/LobbySnapshot.h"
+
+// When the owner hands the session off, members join one per slot instead of all at once.
+// Slots come from the sorted member ids, so every client works out the same order without talking to the others.
+namespace SessionJoinSchedule
+{
+    // Position of the user among the members that join (everyone but the owner), INDEX_NONE for the owner or a stranger
+    EASYMATCHMAKING_API int32 GetSlot(const FLobbySnapshot& Snapshot, EOS_ProductUserId UserId);
+
+    // Slot 0 joins right away, every next slot Spacing later
+    EASYMATCHMAKING_API float GetJoinDelay(int32 Slot, float Spacing);
+
+    // Before try Attempt (2 = first retry): doubles from RetryDelay, members keep their slot offset so retries stay apart too
+    EASYMATCHMAKING_API float GetRetryDelay(int32 Slot, int32 Attempt, float Spacing, float RetryDelay);
+
+    // The session or the backend was busy with another join, the same call can work a moment later
+    EASYMATCHMAKING_API bool IsBusy(EOS_EResult Result);
+
+    // Every member but the owner published SessionId as joined
+    EASYMATCHMAKING_API bool HaveAllMembersJoined(const FLobbySnapshot& Snapshot, const FString& SessionId);
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EasyMatchmakingSettings.h"
+
+struct FIcmpEchoResult;
+
+DECLARE_DELEGATE_OneParam(FOnRegionLatenciesMeasured, const TMap<FString, int32>& /*LatencyMsByRegion*/);
+
+// Pings every configured region a few times and keeps the median round trip per region.
+// Regions are pinged in parallel, the pings of one region one after another. Unreachable regions are left out.
+class EASYMATCHMAKING_API FRegionLatencyProbe : public TSharedFromThis<FRegionLatencyProbe>
+{
+public:
+    void Start(const TArray<FMatchmakingRegion>& InRegions, int32 InPingCount, float InTimeout, FOnRegionLatenciesMeasured&& InOnComplete);
+    bool IsRunning() const { return RegionsLeft > 0; }
+
+private:
+    void SendPing(int32 RegionIndex);
+    void HandleEcho(int32 RegionIndex, const FIcmpEchoResult& Result);
+    void Finish();
+
+    TArray<FMatchmakingRegion> Regions;
+    // Round trips in ms per region
+    TArray<TArray<int32>> Samples;
+    TArray<int32> PingsSent;
+    int32 PingCount = 3;
+    float Timeout = 1.0f;
+    int32 RegionsLeft = 0;
+    FOnRegionLatenciesMeasured OnComplete;
+};
+
+namespace RegionLatency
+{
+    // INDEX_NONE if the region was not measured
+    int32 Find(const TMap<FString, int32>& Latencies, const FString& Region);
+
+    FString GetBestRegion(const TMap<FString, int32>& Latencies);
+
+    // Cap after waiting WaitSeconds, 0 = no cap
+    int32 GetWidenedCap(int32 BaseCapMs, int32 WidenMsPerSecond, int32 MaxCapMs, double WaitSeconds);
+
+    // Measured regions within the cap
+    TArray<FString> GetRegionsWithin(const TMap<FString, int32>& Latencies, int32 CapMs);
+
+    // Region a dedicated server advertises: -Region= on the command line, else ServerRegion from the settings
+    FString GetServerRegion();
+}
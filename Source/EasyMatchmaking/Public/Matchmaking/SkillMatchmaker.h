@@ -0,0 +1,79 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FSkillMatchmakerConfig
+{
+    // Players per match
+    int32 MatchSize = 4;
+    // Rating distance a ticket accepts right away, widened by WindowGrowthPerSecond while it waits
+    double InitialWindow = 100.0;
+    double WindowGrowthPerSecond = 20.0;
+    double MaxWindow = 1000.0;
+    // Neighbours looked at on each side of a ticket in one pass, keeps a pass cheap when the queue is crowded
+    int32 MaxScanPerSide = 64;
+};
+
+struct FSkillTicket
+{
+    int32 TicketId = INDEX_NONE;
+    // Player or lobby the ticket is for
+    FString OwnerId;
+    double Rating = 0.0;
+    int32 PartySize = 1;
+    double EnqueuedAt = 0.0;
+};
+
+struct FSkillMatch
+{
+    TArray<FSkillTicket> Tickets;
+    double MinRating = 0.0;
+    double MaxRating = 0.0;
+};
+
+// Rating based matchmaker. Tickets are kept in an index sorted by rating, a match pass goes over them oldest first
+// and fills a match from the closest ratings inside the oldest ticket's window.
+// No UObjects and no EOS, so it runs the same on clients, listen hosts and the dedicated server.
+// The queue and its rating index serve player pools (AEasyMatchmakingServerGameMode). Quick match only borrows GetWindow:
+// the backend already filters lobbies by the window and the few results are ranked together with latency and attributes.
+class EASYMATCHMAKING_API FSkillMatchmaker
+{
+public:
+    explicit FSkillMatchmaker(const FSkillMatchmakerConfig& InConfig = FSkillMatchmakerConfig());
+
+    // Returns the ticket id, INDEX_NONE if the party does not fit into a match
+    int32 AddTicket(const FString& OwnerId, double Rating, int32 PartySize, double Now);
+    bool RemoveTicket(int32 TicketId);
+    const FSkillTicket* FindTicket(int32 TicketId) const { return Tickets.Find(TicketId); }
+    int32 Num() const { return Tickets.Num(); }
+    void Reset();
+
+    const FSkillMatchmakerConfig& GetConfig() const { return Config; }
+    double GetWindow(const FSkillTicket& Ticket, double Now) const { return GetWindow(Config, Now - Ticket.EnqueuedAt); }
+    static double GetWindow(const FSkillMatchmakerConfig& InConfig, double WaitSeconds);
+
+    // Forms as many matches as it can, matched tickets leave the queue. Returns the number of matches added.
+    int32 RunMatchPass(double Now, TArray<FSkillMatch>& OutMatches);
+
+private:
+    struct FIndexEntry
+    {
+        double Rating;
+        int32 TicketId;
+        // Copied here so a pass does not have to look tickets up
+        int32 PartySize;
+
+        bool operator<(const FIndexEntry& Other) const { return Rating < Other.Rating || (Rating == Other.Rating && TicketId < Other.TicketId); }
+    };
+
+    // Closest unmatched tickets around the anchor, false if they don't add up to a full match
+    bool GatherMatch(int32 AnchorIndex, double Window, const TBitArray<>& Matched, TArray<int32>& OutIndexes) const;
+
+    FSkillMatchmakerConfig Config;
+    TMap<int32, FSkillTicket> Tickets;
+    // Sorted by rating
+    TArray<FIndexEntry> RatingIndex;
+    // Ticket ids in the order they came in, removed tickets are skipped and dropped on the next pass
+    TArray<int32> ArrivalOrder;
+    int32 NextTicketId = 1;
+};
@@ -9,9 +9,21 @@
 
 //Forwad declaration
 class UEOSManager;
+struct FLobbySessionServer;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnSessionsFound, const TArray<FString>&, SessionIds);
 
+enum class ESessionOperation : uint8
+{
+    Create,
+    Search,
+    Join,
+    Destroy
+};
+
+// RequestId is what CreateSession/DestroySession returned, 0 for searches and joins (match joins on the session id)
+DECLARE_MULTICAST_DELEGATE_FourParams(FOnSessionOperationComplete, ESessionOperation /*Operation*/, EOS_EResult /*Result*/, const FString& /*SessionId*/, int32 /*RequestId*/);
+
 UCLASS()
 class EASYMATCHMAKING_API UEOSSessionManager : public UObject
 {
@@ -25,22 +37,41 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Matchmaking")
     void InitServer();
 
-    // Server creates session
+    // Server creates session, returns the request id OnSessionOperationComplete reports back
     UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking")
-    void CreateSession(const FString& SessionName, int32 MaxPlayers);
+    int32 CreateSession(const FString& SessionName, int32 MaxPlayers);
 
     UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking")
     void SearchSessions(const FString& BucketId = TEXT("GameSession"));
 
+    // Returns the request id OnSessionOperationComplete reports back
     UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking")
-    void DestroySession();
+    int32 DestroySession();
 
     UFUNCTION(BlueprintCallable, Category = "EasyMatchmaking")
     void JoinSessionById(const FString& SessionId);
 
+    // Travels to ServerAddress right away and joins the EOS session alongside, for members that got the server from the lobby.
+    // Calling it again for the same session (a retry) only joins.
+    void JoinSessionAtAddress(const FString& SessionId, const FString& ServerAddress);
+
     UPROPERTY(BlueprintAssignable, Category = "EasyMatchmaking")
     FOnSessionsFound OnSessionsFound;
 
+    // C++ only: fires once for every create/search/join/destroy call with how it ended, also when it could not start
+    FOnSessionOperationComplete OnSessionOperationComplete;
+
+    // Our measured latency to the region the session advertises, -1 if unknown
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "EasyMatchmaking")
+    int32 GetSessionLatency(const FString& SessionId) const
+    {
+        const int32* Latency = SessionLatencies.Find(SessionId);
+        return Latency ? *Latency : -1;
+    }
+
+    // Session we are in, empty while a join is still in flight
+    FString GetJoinedSessionId() const { return PendingJoinSessionId.IsEmpty() ? CurrentSessionId : FString(); }
+
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "EasyMatchmaking")
     FString GetCurrentSessionId() const
     {
@@ -56,15 +87,31 @@ private:
     EOS_HSessionSearch CurrentSessionSearchHandle = nullptr;
     // session details for joining, so we dont have to call callbacks again
     TMap<FString, EOS_HSessionDetails> CachedSessionDetails;
+    // Latency to the region of every session of the last search
+    TMap<FString, int32> SessionLatencies;
 
     FString PendingJoinSessionId;
+    // Session we already travel to (JoinSessionAtAddress), its join must not travel a second time
+    FString EarlyTravelSessionId;
+
+    // Create/destroy calls waiting for EOS, one of each at a time (0 = none)
+    int32 NextOperationRequestId = 1;
+    int32 CreateRequestId = 0;
+    int32 DestroyRequestId = 0;
 
     // reference to EOSManager
     UPROPERTY()
     TObjectPtr<UEOSManager> EOSManager = nullptr; 
 
     // Helper functions
+    // A session is one server process, EOS keeps one HostAddress per session and the region attribute says where that server is.
+    // There is no other address to pick, servers in other regions are other sessions.
     FString GetServerAddressFromSessionDetails(EOS_HSessionDetails SessionDetails);
+    FString GetSessionRegion(EOS_HSessionDetails SessionDetails) const;
+    FLobbySessionServer MakeSessionServer(const FString& SessionId, EOS_HSessionDetails SessionDetails);
+    void TravelToServer(const FString& ServerAddress);
+    // Closest first, drops sessions over the latency cap (widened once if that leaves none)
+    void SortSessionsByLatency(TArray<FString>& SessionIds);
 
     static void OnCreateSessionComplete(const EOS_Sessions_UpdateSessionCallbackInfo* Data);
     static void OnJoinSessionComplete(const EOS_Sessions_JoinSessionCallbackInfo* Data);